@@ -39,6 +39,10 @@ THE SOFTWARE.
  */
 AD7746::AD7746() {
     devAddr = AD7746_DEFAULT_ADDRESS;
+    streamHead = streamTail = 0;
+    streamDropped = 0;
+    streamConfiguration = 0;
+    vtCount = vtIndex = 0;
 }
 
 /** Specific address constructor.
@@ -48,6 +52,10 @@ AD7746::AD7746() {
  */
 AD7746::AD7746(uint8_t address) {
     devAddr = address;
+    streamHead = streamTail = 0;
+    streamDropped = 0;
+    streamConfiguration = 0;
+    vtCount = vtIndex = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -105,6 +113,126 @@ uint32_t AD7746::getCapacitance() {
     return capacitance;
 }
 
+/** Read the status register.
+ * RDYCAP and RDYVT are active low: a 0 bit means that channel has an unread
+ * conversion result.
+ * @return Status register value
+ * @see AD7746_RA_STATUS
+ * @see AD7746_RDYCAP_BIT
+ * @see AD7746_RDYVT_BIT
+ */
+uint8_t AD7746::getStatus() {
+    I2Cdev::readByte(devAddr, AD7746_RA_STATUS, buffer);
+    return buffer[0];
+}
+
+/** Start continuous conversion into the sample ring buffer.
+ * Set up the capacitive input and excitation (writeCapSetupRegister(),
+ * writeExcSetupRegister()) first. With a VT setup enabled the part alternates
+ * capacitance and VT conversions. Each time a VT result is collected, the
+ * next entry of vtSetups is written with writeVtSetupRegister(), so several
+ * voltage/temperature inputs share the VT slot in turn. The cap channel is
+ * sampled on every cycle.
+ * @param configuration Configuration register filter bits (AD7746_VTF_*,
+ * AD7746_CAPF_*); the mode bits are replaced with continuous conversion
+ * @param vtSetups VT setup register values to rotate through (each with
+ * AD7746_VTEN), or 0 for capacitance only
+ * @param vtCount Number of entries in vtSetups (0..AD7746_STREAM_VT_CHANNELS)
+ * @see pollStream()
+ */
+void AD7746::startStream(uint8_t configuration, const uint8_t *vtSetups, uint8_t vtCount) {
+    if (vtCount > AD7746_STREAM_VT_CHANNELS) vtCount = AD7746_STREAM_VT_CHANNELS;
+    for (uint8_t i = 0; i < vtCount; i++) vtSetup[i] = vtSetups[i];
+    this -> vtCount = vtCount;
+    vtIndex = 0;
+    streamHead = streamTail = 0;
+    streamDropped = 0;
+    streamConfiguration = configuration & ~((1 << AD7746_MD_BIT_2) | (1 << AD7746_MD_BIT_1) | (1 << AD7746_MD_BIT_0));
+
+    writeVtSetupRegister(vtCount ? vtSetup[0] : 0);
+    writeConfigurationRegister(streamConfiguration | AD7746_MD_CONTINUOUS_CONVERSION);
+}
+
+/** Stop continuous conversion.
+ * Samples already in the ring buffer stay available.
+ */
+void AD7746::stopStream() {
+    writeConfigurationRegister(streamConfiguration | AD7746_MD_IDLE);
+}
+
+/** Collect finished conversions into the ring buffer.
+ * Reads only the status register while nothing is ready. When a result is
+ * pending, reads just the 3-byte data block of the ready channel, or both
+ * blocks in one 6-byte burst if cap and VT are both ready. Call at least
+ * once per conversion period to avoid missing results.
+ * @return Number of samples added (0..2)
+ * @see startStream()
+ */
+uint8_t AD7746::pollStream() {
+    if (I2Cdev::readByte(devAddr, AD7746_RA_STATUS, buffer) != 1) return 0;
+    bool cap = !(buffer[0] & (1 << AD7746_RDYCAP_BIT));
+    bool vt = vtCount && !(buffer[0] & (1 << AD7746_RDYVT_BIT));
+    if (!cap && !vt) return 0;
+
+    uint8_t count;
+    if (cap && vt) {
+        count = I2Cdev::readBytes(devAddr, AD7746_RA_CAP_DATA_H, 6, buffer);
+        if (count != 6) return 0;
+        pushSample(buffer, AD7746_CHANNEL_CAP);
+        pushSample(buffer + 3, vtSetup[vtIndex]);
+    } else {
+        count = I2Cdev::readBytes(devAddr, cap ? AD7746_RA_CAP_DATA_H : AD7746_RA_VT_DATA_H, 3, buffer);
+        if (count != 3) return 0;
+        pushSample(buffer, cap ? AD7746_CHANNEL_CAP : vtSetup[vtIndex]);
+    }
+
+    // the next conversion is capacitance, so the VT input can be switched now
+    if (vt && vtCount > 1) {
+        if (++vtIndex == vtCount) vtIndex = 0;
+        writeVtSetupRegister(vtSetup[vtIndex]);
+    }
+    return cap && vt ? 2 : 1;
+}
+
+/** Get the number of samples waiting in the ring buffer.
+ * @return Sample count (0..AD7746_STREAM_SIZE)
+ */
+uint8_t AD7746::available() {
+    return (uint8_t)(streamHead - streamTail);
+}
+
+/** Take the oldest sample from the ring buffer.
+ * @param sample Output sample
+ * @return True if a sample was returned, false if the buffer is empty
+ */
+bool AD7746::readSample(AD7746Sample *sample) {
+    if (streamHead == streamTail) return false;
+    *sample = stream[streamTail & (AD7746_STREAM_SIZE - 1)];
+    streamTail++;
+    return true;
+}
+
+/** Get the number of samples overwritten because the buffer was full.
+ * The oldest sample is dropped to make room, so the buffer always holds the
+ * most recent readings. Reset by startStream().
+ * @return Dropped sample count
+ */
+uint16_t AD7746::getDroppedSamples() {
+    return streamDropped;
+}
+
+/** Append one 24-bit big-endian result to the ring buffer. */
+void AD7746::pushSample(const uint8_t *data, uint8_t channel) {
+    if ((uint8_t)(streamHead - streamTail) == AD7746_STREAM_SIZE) {
+        streamTail++;
+        streamDropped++;
+    }
+    AD7746Sample *sample = &stream[streamHead & (AD7746_STREAM_SIZE - 1)];
+    sample -> value = ((uint32_t)data[0] << 16) | ((uint32_t)data[1] << 8) | (uint32_t)data[2];
+    sample -> channel = channel;
+    streamHead++;
+}
+
 
 void AD7746::writeCapSetupRegister(uint8_t data) {
     I2Cdev::writeByte(devAddr, AD7746_RA_CAP_SETUP, data);
@@ -157,6 +157,15 @@ THE SOFTWARE.
 
 #define AD7746_DAC_COEFFICIENT           0.13385826771654F // 17pF/127
 
+// Streaming
+#define AD7746_STREAM_SIZE               16   // ring buffer entries, power of two
+#define AD7746_STREAM_VT_CHANNELS        4    // max VT setups rotated between
+#define AD7746_CHANNEL_CAP               0    // AD7746Sample channel for capacitance
+
+struct AD7746Sample {
+    uint32_t value;     // 24-bit conversion result
+    uint8_t channel;    // AD7746_CHANNEL_CAP, or the VT setup register value used
+};
 
 
 class AD7746 {
@@ -169,6 +178,14 @@ class AD7746 {
         void reset(); 
 
         uint32_t getCapacitance();
+        uint8_t getStatus();
+
+        void startStream(uint8_t configuration, const uint8_t *vtSetups, uint8_t vtCount);
+        void stopStream();
+        uint8_t pollStream();
+        uint8_t available();
+        bool readSample(AD7746Sample *sample);
+        uint16_t getDroppedSamples();
     
         void writeCapSetupRegister(uint8_t data);
         void writeVtSetupRegister(uint8_t data);
@@ -181,6 +198,17 @@ class AD7746 {
     private:
         uint8_t devAddr;
         uint8_t buffer[19];
+
+        AD7746Sample stream[AD7746_STREAM_SIZE];
+        uint8_t streamHead;
+        uint8_t streamTail;
+        uint16_t streamDropped;
+        uint8_t streamConfiguration;
+        uint8_t vtSetup[AD7746_STREAM_VT_CHANNELS];
+        uint8_t vtCount;
+        uint8_t vtIndex;
+
+        void pushSample(const uint8_t *data, uint8_t channel);
 };
 
 #endif /* _AD7746_H_ */
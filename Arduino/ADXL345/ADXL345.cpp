@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-07-31 - initial release
+//     2026-10-19 - add FIFO stream setup and batch FIFO reads
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +38,9 @@ THE SOFTWARE.
  */
 ADXL345::ADXL345() {
     devAddr = ADXL345_DEFAULT_ADDRESS;
+    sampleScale = ADXL345_SAMPLE_SCALE;
+    sampleSequence = 0;
+    streamPeriod = 0;
 }
 
 /** Specific address constructor.
@@ -47,6 +51,9 @@ ADXL345::ADXL345() {
  */
 ADXL345::ADXL345(uint8_t address) {
     devAddr = address;
+    sampleScale = ADXL345_SAMPLE_SCALE;
+    sampleSequence = 0;
+    streamPeriod = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -1449,6 +1456,7 @@ uint8_t ADXL345::getFullResolution() {
  */
 void ADXL345::setFullResolution(uint8_t resolution) {
     I2Cdev::writeBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_FULL_RES_BIT, resolution);
+    updateSampleScale();
 }
 /** Get data justification mode setting.
  * A setting of 1 in the justify bit selects left-justified (MSB) mode, and a
@@ -1469,6 +1477,7 @@ uint8_t ADXL345::getDataJustification() {
  */
 void ADXL345::setDataJustification(uint8_t justification) {
     I2Cdev::writeBit(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_JUSTIFY_BIT, justification);
+    updateSampleScale();
 }
 /** Get data range setting.
  * These bits set the g range as described in Table 21. (That is, 0x0 - 0x3 to
@@ -1491,6 +1500,7 @@ uint8_t ADXL345::getRange() {
  */
 void ADXL345::setRange(uint8_t range) {
     I2Cdev::writeBits(devAddr, ADXL345_RA_DATA_FORMAT, ADXL345_FORMAT_RANGE_BIT, ADXL345_FORMAT_RANGE_LENGTH, range);
+    updateSampleScale();
 }
 
 // DATA* registers
@@ -1666,3 +1676,100 @@ uint8_t ADXL345::getFIFOLength() {
     I2Cdev::readBits(devAddr, ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_LENGTH_BIT, ADXL345_FIFOSTAT_LENGTH_LENGTH, buffer);
     return buffer[0];
 }
+
+// FIFO batch reads
+
+/** Configure FIFO stream mode with a watermark interrupt.
+ * Writes the whole FIFO_CTL register at once (stream mode, trigger pin and
+ * sample count), then maps and enables the WATERMARK interrupt. When the
+ * interrupt fires, drain the FIFO with getFIFOAcceleration() or getSamples().
+ * The output data rate is cached here for getSamples() timestamps, so set the
+ * rate first.
+ * @param watermark Number of FIFO entries that raise the interrupt (1-31)
+ * @param pin Interrupt pin for WATERMARK (0 = INT1, 1 = INT2)
+ * @see getFIFOAcceleration()
+ * @see ADXL345_RA_FIFO_CTL
+ * @see ADXL345_FIFO_MODE_STREAM
+ */
+void ADXL345::initializeFIFOStream(uint8_t watermark, uint8_t pin) {
+    uint8_t fifoCtl = (ADXL345_FIFO_MODE_STREAM << (ADXL345_FIFO_MODE_BIT - ADXL345_FIFO_MODE_LENGTH + 1))
+                    | ((pin ? 1 : 0) << ADXL345_FIFO_TRIGGER_BIT)
+                    | (watermark & 0x1F);
+    I2Cdev::writeByte(devAddr, ADXL345_RA_FIFO_CTL, fifoCtl);
+    setIntWatermarkPin(pin);
+    setIntWatermarkEnabled(true);
+
+    // rate code 10 is 100 Hz; each step doubles or halves the rate
+    uint8_t rate = getRate();
+    streamPeriod = rate > 10 ? 10000UL >> (rate - 10) : 10000UL << (10 - rate);
+}
+/** Drain buffered FIFO samples into a caller buffer.
+ * The FIFO entry count is read once, then each entry is popped with a 6-byte
+ * burst from DATAX0 back-to-back. Each entry has to be its own burst since
+ * the FIFO only advances when a read of the data registers ends; reading past
+ * DATAZ1 would run into FIFO_CTL instead of the next entry.
+ * @param samples Buffer for packed samples as x0, y0, z0, x1, y1, z1, ...
+ *                (room for 3 * maxSamples values)
+ * @param maxSamples Maximum number of samples to read
+ * @return Number of samples stored in the buffer
+ * @see initializeFIFOStream()
+ * @see getFIFOLength()
+ * @see ADXL345_RA_DATAX0
+ */
+uint8_t ADXL345::getFIFOAcceleration(int16_t *samples, uint8_t maxSamples) {
+    uint8_t count = getFIFOLength();
+    if (count > maxSamples) count = maxSamples;
+    return readFIFO(samples, 3, count);
+}
+/** Read acceleration into MotionSamples.
+ * After initializeFIFOStream() this drains the FIFO like
+ * getFIFOAcceleration(), decoding straight into the sample array; entries are
+ * oldest first, the newest stamped with micros() after the read and each
+ * older one a period earlier. Otherwise it reads the current output
+ * registers as one sample.
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer
+ * @return Number of samples written
+ * @see getFIFOAcceleration()
+ * @see MotionSample
+ */
+uint8_t ADXL345::getSamples(MotionSample *samples, uint8_t maxSamples) {
+    uint8_t count = streamPeriod ? getFIFOLength() : 1;
+    if (count > maxSamples) count = maxSamples;
+    count = readFIFO(&samples -> x, MOTION_SAMPLE_STRIDE, count);
+    uint32_t now = micros();
+    for (uint8_t i = 0; i < count; i++, samples++) {
+        samples -> timestamp = now - (uint32_t)(count - 1 - i) * streamPeriod;
+        samples -> sequence = sampleSequence++;
+        samples -> type = MOTION_SAMPLE_ACCEL;
+        samples -> scale = sampleScale;
+    }
+    return count;
+}
+
+/** Pop FIFO entries with one 6-byte burst each.
+ * The count is capped at ADXL345_FIFO_MAX_ENTRIES; the 6-bit entries field
+ * can read higher than the FIFO can hold after a bus glitch.
+ * @param xyz Destination of the first sample's X value
+ * @param stride Distance from one sample's X to the next, in int16_t
+ * @param count Number of entries to read
+ * @return Number of entries read before any bus error
+ */
+uint8_t ADXL345::readFIFO(int16_t *xyz, uint8_t stride, uint8_t count) {
+    if (count > ADXL345_FIFO_MAX_ENTRIES) count = ADXL345_FIFO_MAX_ENTRIES;
+    for (uint8_t i = 0; i < count; i++, xyz += stride) {
+        if (I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, buffer) != 6) return i;
+        xyz[0] = (((int16_t)buffer[1]) << 8) | buffer[0];
+        xyz[1] = (((int16_t)buffer[3]) << 8) | buffer[2];
+        xyz[2] = (((int16_t)buffer[5]) << 8) | buffer[4];
+    }
+    return count;
+}
+/** Refresh the cached MotionSample scale from DATA_FORMAT. */
+void ADXL345::updateSampleScale() {
+    I2Cdev::readByte(devAddr, ADXL345_RA_DATA_FORMAT, buffer);
+    uint8_t range = (buffer[0] >> (ADXL345_FORMAT_RANGE_BIT - ADXL345_FORMAT_RANGE_LENGTH + 1)) & 0x03;
+    if (buffer[0] & (1 << ADXL345_FORMAT_JUSTIFY_BIT)) sampleScale = ADXL345_SAMPLE_SCALE_LEFT + range;
+    else if (buffer[0] & (1 << ADXL345_FORMAT_FULL_RES_BIT)) sampleScale = ADXL345_SAMPLE_SCALE;
+    else sampleScale = ADXL345_SAMPLE_SCALE + range;
+}
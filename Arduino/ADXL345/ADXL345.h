@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-07-31 - initial release
+//     2026-10-19 - add FIFO stream setup and batch FIFO reads
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -34,6 +35,7 @@ THE SOFTWARE.
 #define _ADXL345_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 #define ADXL345_ADDRESS_ALT_LOW     0x53 // alt address pin low (GND)
 #define ADXL345_ADDRESS_ALT_HIGH    0x1D // alt address pin high (VCC)
@@ -163,6 +165,11 @@ THE SOFTWARE.
 #define ADXL345_FIFOSTAT_LENGTH_BIT         5
 #define ADXL345_FIFOSTAT_LENGTH_LENGTH      6
 
+#define ADXL345_FIFO_MAX_ENTRIES    33 // 32 FIFO levels plus the output registers
+
+#define ADXL345_SAMPLE_SCALE        (-8)  // 3.9 mg per LSB, full resolution or +/-2g
+#define ADXL345_SAMPLE_SCALE_LEFT   (-14) // left-justified at +/-2g
+
 class ADXL345 {
     public:
         ADXL345();
@@ -353,9 +360,20 @@ class ADXL345 {
         bool getFIFOTriggerOccurred();
         uint8_t getFIFOLength();
 
+        // FIFO batch reads
+        void initializeFIFOStream(uint8_t watermark, uint8_t pin);
+        uint8_t getFIFOAcceleration(int16_t *samples, uint8_t maxSamples);
+        uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
+
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        int8_t sampleScale;
+        uint16_t sampleSequence;
+        uint32_t streamPeriod;  // microseconds between FIFO entries, 0 when not streaming
+
+        void updateSampleScale();
+        uint8_t readFIFO(int16_t *xyz, uint8_t stride, uint8_t count);
 };
 
 #endif /* _ADXL345_H_ */
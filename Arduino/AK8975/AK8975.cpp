@@ -5,6 +5,8 @@
 //
 // Changelog:
 //     2011-08-27 - initial release
+//     2026-10-19 - add Fuse ROM sensitivity adjustment read
+//                - add non-blocking pipelined measurement reads
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +39,10 @@ THE SOFTWARE.
  */
 AK8975::AK8975() {
     devAddr = AK8975_DEFAULT_ADDRESS;
+    pipelineDrdyPin = -1;
+    pipelinePending = false;
+    pipelineHeading[0] = pipelineHeading[1] = pipelineHeading[2] = 0;
+    sampleSequence = 0;
 }
 
 /** Specific address constructor.
@@ -46,6 +52,10 @@ AK8975::AK8975() {
  */
 AK8975::AK8975(uint8_t address) {
     devAddr = address;
+    pipelineDrdyPin = -1;
+    pipelinePending = false;
+    pipelineHeading[0] = pipelineHeading[1] = pipelineHeading[2] = 0;
+    sampleSequence = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -114,6 +124,87 @@ int16_t AK8975::getHeadingZ() {
     return (((int16_t)buffer[1]) << 8) | buffer[0];
 }
 
+// pipelined measurements
+
+/** Start pipelined measurements.
+ * Triggers the first single measurement right away. After this, call
+ * getHeadingPipelined() from the control loop as often as you like.
+ * @param drdyPin Arduino pin wired to the DRDY output, or -1 to poll the ST1
+ * register instead
+ * @see getHeadingPipelined()
+ */
+void AK8975::initializePipeline(int8_t drdyPin) {
+    pipelineDrdyPin = drdyPin;
+    if (drdyPin >= 0) pinMode(drdyPin, INPUT);
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
+    pipelineStart = micros();
+    pipelinePending = true;
+}
+/** Get the latest completed heading without blocking.
+ * Until AK8975_MEASUREMENT_TIME has passed since the last trigger this does
+ * not touch the bus at all. After that it checks DRDY (pin or ST1 register),
+ * reads HXL through ST2 in one burst (reading ST2 releases the data
+ * registers), and triggers the next measurement immediately so it converts
+ * while the caller works. Samples flagged with overflow or data error in ST2
+ * are dropped. If no data is ready within AK8975_MEASUREMENT_TIMEOUT (the
+ * trigger or the read was lost on the bus), single measurement mode is
+ * written again and the pipeline restarts.
+ * @param x Container for X-axis heading of the latest completed sample
+ * @param y Container for Y-axis heading of the latest completed sample
+ * @param z Container for Z-axis heading of the latest completed sample
+ * @return True if the containers hold a new sample, false if it is the same
+ * sample as last time
+ * @see initializePipeline()
+ */
+bool AK8975::getHeadingPipelined(int16_t *x, int16_t *y, int16_t *z) {
+    bool fresh = false;
+    if (!pipelinePending) {
+        initializePipeline(pipelineDrdyPin);
+    } else if (micros() - pipelineStart >= AK8975_MEASUREMENT_TIME) {
+        bool ready = pipelineDrdyPin >= 0 ? digitalRead(pipelineDrdyPin) == HIGH : getDataReady();
+        if (!ready && micros() - pipelineStart >= AK8975_MEASUREMENT_TIMEOUT) {
+            initializePipeline(pipelineDrdyPin);
+        } else if (ready && I2Cdev::readBytes(devAddr, AK8975_RA_HXL, 7, buffer) == 7) {
+            I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
+            pipelineStart = micros();
+            if (!(buffer[6] & ((1 << AK8975_ST2_HOFL_BIT) | (1 << AK8975_ST2_DERR_BIT)))) {
+                pipelineHeading[0] = (((int16_t)buffer[1]) << 8) | buffer[0];
+                pipelineHeading[1] = (((int16_t)buffer[3]) << 8) | buffer[2];
+                pipelineHeading[2] = (((int16_t)buffer[5]) << 8) | buffer[4];
+                fresh = true;
+            }
+        }
+    }
+    *x = pipelineHeading[0];
+    *y = pipelineHeading[1];
+    *z = pipelineHeading[2];
+    return fresh;
+}
+
+/** Get the latest heading as a MotionSample.
+ * Once initializePipeline() has been called this is non-blocking and only
+ * returns a sample when getHeadingPipelined() has a new one; otherwise it
+ * runs a blocking getHeading() measurement.
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer
+ * @return Number of samples written (0 or 1)
+ * @see getHeadingPipelined()
+ * @see MotionSample
+ */
+uint8_t AK8975::getSamples(MotionSample *samples, uint8_t maxSamples) {
+    if (maxSamples == 0) return 0;
+    if (pipelinePending) {
+        if (!getHeadingPipelined(&samples -> x, &samples -> y, &samples -> z)) return 0;
+    } else {
+        getHeading(&samples -> x, &samples -> y, &samples -> z);
+    }
+    samples -> timestamp = micros();
+    samples -> sequence = sampleSequence++;
+    samples -> type = MOTION_SAMPLE_MAG;
+    samples -> scale = AK8975_SAMPLE_SCALE;
+    return 1;
+}
+
 // ST2 register
 bool AK8975::getOverflowStatus() {
     I2Cdev::readBit(devAddr, AK8975_RA_ST2, AK8975_ST2_HOFL_BIT, buffer);
@@ -179,4 +270,23 @@ uint8_t AK8975::getAdjustmentZ() {
 }
 void AK8975::setAdjustmentZ(uint8_t z) {
     I2Cdev::writeByte(devAddr, AK8975_RA_ASAZ, z);
-}
\ No newline at end of file
+}
+/** Read factory sensitivity adjustment values from Fuse ROM.
+ * The ASA registers only hold valid data in Fuse ROM access mode, so this
+ * switches to that mode for the read and powers down again afterwards. The
+ * adjusted heading is H * (ASA + 128) / 256 for each axis.
+ * @param x Container for X-axis ASA value
+ * @param y Container for Y-axis ASA value
+ * @param z Container for Z-axis ASA value
+ * @see MagCalibration::setSensitivityAdjustment()
+ * @see AK8975_MODE_FUSEROM
+ */
+void AK8975::getSensitivityAdjustment(uint8_t *x, uint8_t *y, uint8_t *z) {
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_FUSEROM);
+    I2Cdev::readBytes(devAddr, AK8975_RA_ASAX, 3, buffer);
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_POWERDOWN);
+    delayMicroseconds(100); // datasheet: wait 100us in power-down before the next mode change
+    *x = buffer[0];
+    *y = buffer[1];
+    *z = buffer[2];
+}
@@ -5,6 +5,8 @@
 //
 // Changelog:
 //     2011-08-27 - initial release
+//     2026-10-19 - add Fuse ROM sensitivity adjustment read
+//                - add non-blocking pipelined measurement reads
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -34,6 +36,7 @@ THE SOFTWARE.
 #define _AK8975_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 #define AK8975_ADDRESS_00         0x0C
 #define AK8975_ADDRESS_01         0x0D
@@ -78,6 +81,10 @@ THE SOFTWARE.
 
 #define AK8975_I2CDIS_BIT         0
 
+#define AK8975_MEASUREMENT_TIME   7300 // typical single measurement time in microseconds
+#define AK8975_MEASUREMENT_TIMEOUT 18000 // twice the 9 ms maximum; re-trigger after this
+#define AK8975_SAMPLE_SCALE       (-2) // 0.3 uT per LSB, as 2^-2 uT
+
 class AK8975 {
     public:
         AK8975();
@@ -100,6 +107,11 @@ class AK8975 {
         int16_t getHeadingX();
         int16_t getHeadingY();
         int16_t getHeadingZ();
+
+        // pipelined measurements
+        void initializePipeline(int8_t drdyPin=-1);
+        bool getHeadingPipelined(int16_t *x, int16_t *y, int16_t *z);
+        uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
         
         // ST2 register
         bool getOverflowStatus();
@@ -125,11 +137,18 @@ class AK8975 {
         void setAdjustmentY(uint8_t y);
         uint8_t getAdjustmentZ();
         void setAdjustmentZ(uint8_t z);
+        void getSensitivityAdjustment(uint8_t *x, uint8_t *y, uint8_t *z);
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[7];
+        uint16_t sampleSequence;
         uint8_t mode;
+
+        int8_t pipelineDrdyPin;
+        bool pipelinePending;
+        uint32_t pipelineStart;
+        int16_t pipelineHeading[3];
 };
 
 #endif /* _AK8975_H_ */
\ No newline at end of file
@@ -37,6 +37,8 @@ THE SOFTWARE.
  */
 BMA150::BMA150() {
     devAddr = BMA150_DEFAULT_ADDRESS;
+    sampleScale = BMA150_SAMPLE_SCALE_2G;
+    sampleSequence = 0;
 }
 
 /** Specific address constructor.
@@ -46,6 +48,8 @@ BMA150::BMA150() {
  */
 BMA150::BMA150(uint8_t address) {
     devAddr = address;
+    sampleScale = BMA150_SAMPLE_SCALE_2G;
+    sampleSequence = 0;
 }
 
 /** Power on and prepare for general usage. This sets the full scale range of 
@@ -101,6 +105,53 @@ void BMA150::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
     *z = ((((int16_t)buffer[5]) << 8) | buffer[4]) >> 6;
 }
 
+/** Get 3-axis accelerometer readings only if they have not been read yet.
+ * Takes the same 6-byte burst as getAcceleration(), and checks the new_data
+ * flags in bit 0 of each LSB register from that burst, instead of making
+ * separate newDataX/Y/Z() reads. The burst clears the flags, so each
+ * conversion is reported exactly once. If no axis has new data, x, y
+ * and z are left untouched and the caller can skip the duplicate sample.
+ * @param x 16-bit signed integer container for X-axis acceleration
+ * @param y 16-bit signed integer container for Y-axis acceleration
+ * @param z 16-bit signed integer container for Z-axis acceleration
+ * @return BMA150_NEW_DATA_X/Y/Z flags of the updated axes, 0 if nothing new
+ * (or the read failed)
+ * @see getAcceleration()
+ * @see BMA150_RA_X_AXIS_LSB
+ */
+uint8_t BMA150::getNewAcceleration(int16_t* x, int16_t* y, int16_t* z) {
+    if (I2Cdev::readBytes(devAddr, BMA150_RA_X_AXIS_LSB, 6, buffer) != 6) return 0;
+    uint8_t fresh = ((buffer[0] >> BMA150_X_NEW_DATA_BIT) & 1)
+                  | (((buffer[2] >> BMA150_Y_NEW_DATA_BIT) & 1) << 1)
+                  | (((buffer[4] >> BMA150_Z_NEW_DATA_BIT) & 1) << 2);
+    if (fresh) {
+        *x = ((((int16_t)buffer[1]) << 8) | buffer[0]) >> 6;
+        *y = ((((int16_t)buffer[3]) << 8) | buffer[2]) >> 6;
+        *z = ((((int16_t)buffer[5]) << 8) | buffer[4]) >> 6;
+    }
+    return fresh;
+}
+
+/** Get the current acceleration as a MotionSample.
+ * Uses getNewAcceleration(), so a sample is only published once per sensor
+ * conversion; polling faster than the bandwidth setting returns 0 instead of
+ * repeating the previous reading. The scale follows the range last set
+ * through setRange().
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer
+ * @return Number of samples written (0 or 1)
+ * @see getNewAcceleration()
+ * @see MotionSample
+ */
+uint8_t BMA150::getSamples(MotionSample *samples, uint8_t maxSamples) {
+    if (maxSamples == 0 || !getNewAcceleration(&samples -> x, &samples -> y, &samples -> z)) return 0;
+    samples -> timestamp = micros();
+    samples -> sequence = sampleSequence++;
+    samples -> type = MOTION_SAMPLE_ACCEL;
+    samples -> scale = sampleScale;
+    return 1;
+}
+
 /** Get X-axis accelerometer reading.
  * @return X-axis acceleration measurement in 16-bit 2's complement format
  * @see BMA150_RA_X_AXIS_LSB
@@ -515,6 +566,7 @@ uint8_t BMA150::getRange() {
  */
 void BMA150::setRange(uint8_t range) {
     I2Cdev::writeBits(devAddr, BMA150_RA_RANGE_BWIDTH, BMA150_RANGE_BIT, BMA150_RANGE_LENGTH, range);
+    sampleScale = BMA150_SAMPLE_SCALE_2G + range;
 }
 
 
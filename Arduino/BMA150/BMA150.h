@@ -34,6 +34,7 @@ THE SOFTWARE.
 #define _BMA150_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 #define BMA150_ADDRESS_00           0xA1                // Default Address
 #define BMA150_ADDRESS_01           0x38                // Used on the Atmel ATAVRSBIN1
@@ -85,6 +86,10 @@ THE SOFTWARE.
 #define BMA150_Z_AXIS_LSB_LENGTH       2
 #define BMA150_Z_NEW_DATA_BIT          0
 
+#define BMA150_NEW_DATA_X              0x01    // getNewAcceleration() result flags
+#define BMA150_NEW_DATA_Y              0x02
+#define BMA150_NEW_DATA_Z              0x04
+
 #define BMA150_STATUS_HG_BIT           0
 #define BMA150_STATUS_LG_BIT           1
 #define BMA150_HG_LATCHED_BIT          2
@@ -135,6 +140,8 @@ THE SOFTWARE.
 #define BMA150_RANGE_4G                1
 #define BMA150_RANGE_8G                2
 
+#define BMA150_SAMPLE_SCALE_2G         (-8) // 10-bit output: 2^-8 g per LSB at +/-2g
+
 #define BMA150_BW_25HZ                 0
 #define BMA150_BW_50HZ                 1
 #define BMA150_BW_100HZ                2
@@ -166,6 +173,8 @@ class BMA150 {
         int16_t getAccelerationX();
         int16_t getAccelerationY();
         int16_t getAccelerationZ();
+        uint8_t getNewAcceleration(int16_t* x, int16_t* y, int16_t* z);
+        uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
         bool newDataX();
         bool newDataY();
         bool newDataZ();
@@ -275,6 +284,8 @@ class BMA150 {
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        int8_t sampleScale;
+        uint16_t sampleSequence;
 };
 
 #endif /* _BMA150_H_ */
\ No newline at end of file
@@ -8,6 +8,8 @@
 //     2011-11-13 - initial release
 //     2012-03-29 - alain.spineux@gmail.com: bug in getHours24() 
 //                  am/pm is bit 0x20 instead of 0x80
+//     2026-10-19 - add single-burst timekeeping snapshot and epoch conversion
+//                - add block RAM read/write
 //
 
 /* ============================================
@@ -35,6 +37,35 @@ THE SOFTWARE.
 */
 
 #include "DS1307.h"
+#include <avr/pgmspace.h>
+
+#define SECONDS_PER_DAY 86400L
+#define SECONDS_FROM_1970_TO_2000 946684800
+
+// packed BCD to binary, i.e. 10 * tens + ones == (16 * tens + ones) - 6 * tens
+static inline uint8_t bcd2bin(uint8_t value) {
+    return value - 6 * (value >> 4);
+}
+
+// days preceding the first of each month in a non-leap year
+static const uint16_t daysBeforeMonth [] PROGMEM = { 0,31,59,90,120,151,181,212,243,273,304,334 };
+
+// number of days since 2000/01/01, valid for 2001..2099. month is clamped to
+// 1..12 so a corrupt RTC register cannot index past the table
+static uint16_t date2days(uint16_t y, uint8_t m, uint8_t d) {
+    if (y >= 2000)
+        y -= 2000;
+    if (m < 1) m = 1;
+    else if (m > 12) m = 12;
+    uint16_t days = d + pgm_read_word(daysBeforeMonth + m - 1);
+    if (m > 2 && y % 4 == 0)
+        ++days;
+    return days + 365 * y + (y + 3) / 4 - 1;
+}
+
+static long time2long(uint16_t days, uint8_t h, uint8_t m, uint8_t s) {
+    return ((days * 24L + h) * 60 + m) * 60 + s;
+}
 
 /** Default constructor, uses default I2C address.
  * @see DS1307_DEFAULT_ADDRESS
@@ -269,14 +300,52 @@ void DS1307::setSquareWaveRate(uint8_t rate) {
 
 // RAM registers
 uint8_t DS1307::getMemoryByte(uint8_t offset) {
-    if (offset > 55) return 0;
+    if (offset >= DS1307_RAM_LENGTH) return 0;
     I2Cdev::readByte(devAddr, DS1307_RA_RAM + offset, buffer);
     return buffer[0];
 }
 void DS1307::setMemoryByte(uint8_t offset, uint8_t value) {
-    if (offset > 55) return;
+    if (offset >= DS1307_RAM_LENGTH) return;
     I2Cdev::writeByte(devAddr, DS1307_RA_RAM + offset, value);
 }
+/** Read a block of battery-backed RAM.
+ * Blocks up to DS1307_RAM_BURST_LENGTH bytes are read in one transaction;
+ * longer blocks are split into that many bytes per transaction.
+ * @param offset First RAM byte to read (0-55)
+ * @param length Number of bytes to read (offset + length must not exceed 56)
+ * @param data Buffer to store read data in
+ * @return True if the whole block was read, false otherwise
+ */
+bool DS1307::getMemoryBytes(uint8_t offset, uint8_t length, uint8_t *data) {
+    if (offset >= DS1307_RAM_LENGTH || length > DS1307_RAM_LENGTH - offset) return false;
+    while (length > 0) {
+        uint8_t chunk = min(length, DS1307_RAM_BURST_LENGTH);
+        if (I2Cdev::readBytes(devAddr, DS1307_RA_RAM + offset, chunk, data) != chunk) return false;
+        offset += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+    return true;
+}
+/** Write a block of battery-backed RAM.
+ * Blocks up to DS1307_RAM_BURST_LENGTH bytes are written in one transaction;
+ * longer blocks are split into that many bytes per transaction.
+ * @param offset First RAM byte to write (0-55)
+ * @param length Number of bytes to write (offset + length must not exceed 56)
+ * @param data Buffer to copy new data from
+ * @return True if the whole block was written, false otherwise
+ */
+bool DS1307::setMemoryBytes(uint8_t offset, uint8_t length, uint8_t *data) {
+    if (offset >= DS1307_RAM_LENGTH || length > DS1307_RAM_LENGTH - offset) return false;
+    while (length > 0) {
+        uint8_t chunk = min(length, DS1307_RAM_BURST_LENGTH);
+        if (!I2Cdev::writeBytes(devAddr, DS1307_RA_RAM + offset, chunk, data)) return false;
+        offset += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+    return true;
+}
 
 // convenience methods
 
@@ -319,8 +388,17 @@ void DS1307::setTime24(uint8_t hours, uint8_t minutes, uint8_t seconds) {
 }
 
 void DS1307::getDateTime12(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm) {
-    getTime12(hours, minutes, seconds, ampm);
-    getDate(year, month, day);
+    DS1307Snapshot snapshot;
+    if (!getSnapshot(&snapshot)) return;
+    *year = snapshot.year;
+    *month = snapshot.month;
+    *day = snapshot.day;
+    *ampm = snapshot.hours > 11;
+    if (snapshot.hours > 12) *hours = snapshot.hours - 12;
+    else if (snapshot.hours == 0) *hours = 12;
+    else *hours = snapshot.hours;
+    *minutes = snapshot.minutes;
+    *seconds = snapshot.seconds;
 }
 void DS1307::setDateTime12(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t ampm) {
     setTime12(hours, minutes, seconds, ampm);
@@ -328,17 +406,91 @@ void DS1307::setDateTime12(uint16_t year, uint8_t month, uint8_t day, uint8_t ho
 }
 
 void DS1307::getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
-    getTime24(hours, minutes, seconds);
-    getDate(year, month, day);
+    DS1307Snapshot snapshot;
+    if (!getSnapshot(&snapshot)) return;
+    *year = snapshot.year;
+    *month = snapshot.month;
+    *day = snapshot.day;
+    *hours = snapshot.hours;
+    *minutes = snapshot.minutes;
+    *seconds = snapshot.seconds;
 }
 void DS1307::setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds) {
     setTime24(hours, minutes, seconds);
     setDate(year, month, day);
 }
 
+/** Read all timekeeping registers in a single burst.
+ * Reading SECONDS through YEAR in one transaction lets the DS1307 latch them
+ * into its secondary buffer together, so the result cannot tear across a
+ * seconds rollover the way separate per-register reads can. Hours are always
+ * returned in 24-hour format. The internal 12/24-hour mode and clock halt
+ * state are refreshed as a side effect.
+ * @param snapshot Container for decoded date/time values
+ * @return True if all registers were read, false otherwise
+ */
+bool DS1307::getSnapshot(DS1307Snapshot *snapshot) {
+    if (I2Cdev::readBytes(devAddr, DS1307_RA_SECONDS, DS1307_TIMEKEEPING_LENGTH, buffer) != DS1307_TIMEKEEPING_LENGTH) return false;
+    clockHalt = buffer[0] & 0x80;
+    mode12 = buffer[2] & 0x40;
+    snapshot -> clockHalt = clockHalt;
+    snapshot -> seconds = bcd2bin(buffer[0] & 0x7F);
+    snapshot -> minutes = bcd2bin(buffer[1] & 0x7F);
+    if (mode12) {
+        // Byte: [5 = AM/PM] [4 = 10HR] [3:0 = 1HR]
+        uint8_t hours = bcd2bin(buffer[2] & 0x1F);
+        if (buffer[2] & 0x20) {
+            if (hours < 12) hours += 12;
+        } else {
+            if (hours == 12) hours = 0;
+        }
+        snapshot -> hours = hours;
+    } else {
+        // Byte: [5:4 = 10HR] [3:0 = 1HR]
+        snapshot -> hours = bcd2bin(buffer[2] & 0x3F);
+    }
+    snapshot -> dayOfWeek = buffer[3] & 0x07;
+    snapshot -> day = bcd2bin(buffer[4] & 0x3F);
+    snapshot -> month = bcd2bin(buffer[5] & 0x1F);
+    snapshot -> year = 2000 + bcd2bin(buffer[6]);
+    return true;
+}
+
+/** Get current time as seconds since 2000-01-01 00:00:00.
+ * @return Seconds since 2000, or 0 if the device could not be read
+ * @see getSnapshot()
+ */
+uint32_t DS1307::getSecondsTime() {
+    DS1307Snapshot snapshot;
+    if (!getSnapshot(&snapshot)) return 0;
+    return snapshotToSecondsTime(&snapshot);
+}
+
+/** Get current time as seconds since 1970-01-01 00:00:00.
+ * @return Unix timestamp, or 0 if the device could not be read
+ * @see getSnapshot()
+ */
+uint32_t DS1307::getUnixTime() {
+    DS1307Snapshot snapshot;
+    if (!getSnapshot(&snapshot)) return 0;
+    return snapshotToSecondsTime(&snapshot) + SECONDS_FROM_1970_TO_2000;
+}
+
+/** Convert a decoded snapshot to seconds since 2000-01-01 00:00:00.
+ * No time zone, DST or leap second handling, same as the DateTime class.
+ * @param snapshot Snapshot previously filled by getSnapshot()
+ * @return Seconds since 2000
+ */
+uint32_t DS1307::snapshotToSecondsTime(const DS1307Snapshot *snapshot) {
+    uint16_t days = date2days(snapshot -> year, snapshot -> month, snapshot -> day);
+    return time2long(days, snapshot -> hours, snapshot -> minutes, snapshot -> seconds);
+}
+
 #ifdef DS1307_INCLUDE_DATETIME_METHODS
     DateTime DS1307::getDateTime() {
-        DateTime dt = DateTime(getYear(), getMonth(), getDay(), getHours24(), getMinutes(), getSeconds());
+        DS1307Snapshot snapshot;
+        if (!getSnapshot(&snapshot)) return DateTime(SECONDS_FROM_1970_TO_2000); // 2000-01-01, like getSecondsTime()
+        DateTime dt = DateTime(snapshot.year, snapshot.month, snapshot.day, snapshot.hours, snapshot.minutes, snapshot.seconds);
         return dt;
     }
     void DS1307::setDateTime(DateTime dt) {
@@ -353,31 +505,12 @@ void DS1307::setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint8_t ho
 
 #ifdef DS1307_INCLUDE_DATETIME_CLASS
     // DateTime class courtesy of public domain JeeLabs code
-    #include <avr/pgmspace.h>
-    #define SECONDS_PER_DAY 86400L
-    #define SECONDS_FROM_1970_TO_2000 946684800
     
     ////////////////////////////////////////////////////////////////////////////////
     // utility code, some of this could be exposed in the DateTime API if needed
     
     static uint8_t daysInMonth [] PROGMEM = { 31,28,31,30,31,30,31,31,30,31,30,31 };
     
-    // number of days since 2000/01/01, valid for 2001..2099
-    static uint16_t date2days(uint16_t y, uint8_t m, uint8_t d) {
-        if (y >= 2000)
-            y -= 2000;
-        uint16_t days = d;
-        for (uint8_t i = 1; i < m; ++i)
-            days += pgm_read_byte(daysInMonth + i - 1);
-        if (m > 2 && y % 4 == 0)
-            ++days;
-        return days + 365 * y + (y + 3) / 4 - 1;
-    }
-    
-    static long time2long(uint16_t days, uint8_t h, uint8_t m, uint8_t s) {
-        return ((days * 24L + h) * 60 + m) * 60 + s;
-    }
-    
     ////////////////////////////////////////////////////////////////////////////////
     // DateTime implementation - ignores time zones and DST changes
     // NOTE: also ignores leap seconds, see http://en.wikipedia.org/wiki/Leap_second
@@ -6,6 +6,8 @@
 //
 // Changelog:
 //     2011-11-13 - initial release
+//     2026-10-19 - add single-burst timekeeping snapshot and epoch conversion
+//                - add block RAM read/write
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -100,6 +102,22 @@ THE SOFTWARE.
 #define DS1307_SQW_RATE_8192        0x2
 #define DS1307_SQW_RATE_32768       0x3
 
+#define DS1307_TIMEKEEPING_LENGTH   7 // SECONDS through YEAR registers
+#define DS1307_RAM_LENGTH           56
+#define DS1307_RAM_BURST_LENGTH     28 // keeps address + data inside a 32-byte Wire buffer
+
+// decoded copy of all timekeeping registers, read in a single transaction
+typedef struct {
+    uint16_t year;      // 2000-2099
+    uint8_t month;      // 1-12
+    uint8_t day;        // 1-31
+    uint8_t dayOfWeek;  // 1-7
+    uint8_t hours;      // 0-23, regardless of device 12/24-hour mode
+    uint8_t minutes;    // 0-59
+    uint8_t seconds;    // 0-59
+    bool clockHalt;
+} DS1307Snapshot;
+
 #ifdef DS1307_INCLUDE_DATETIME_CLASS
     // DateTime class courtesy of public domain JeeLabs code
     // simple general-purpose date/time class (no TZ / DST / leap second handling!)
@@ -181,6 +199,8 @@ class DS1307 {
         // RAM registers
         uint8_t getMemoryByte(uint8_t offset);
         void setMemoryByte(uint8_t offset, uint8_t value);
+        bool getMemoryBytes(uint8_t offset, uint8_t length, uint8_t *data);
+        bool setMemoryBytes(uint8_t offset, uint8_t length, uint8_t *data);
 
         // convenience methods
 
@@ -199,6 +219,12 @@ class DS1307 {
         void getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
         void setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds);
         
+        // single-burst timekeeping read
+        bool getSnapshot(DS1307Snapshot *snapshot);
+        uint32_t getSecondsTime(); // seconds since 2000-01-01 00:00:00
+        uint32_t getUnixTime(); // seconds since 1970-01-01 00:00:00
+        static uint32_t snapshotToSecondsTime(const DS1307Snapshot *snapshot);
+
         #ifdef DS1307_INCLUDE_DATETIME_METHODS
             DateTime getDateTime();
             void setDateTime(DateTime dt);
@@ -206,7 +232,7 @@ class DS1307 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[1];
+        uint8_t buffer[DS1307_TIMEKEEPING_LENGTH];
         bool mode12;
         bool clockHalt;
 };
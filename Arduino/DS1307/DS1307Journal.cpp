@@ -0,0 +1,159 @@
+// I2Cdev library collection - DS1307 battery-backed RAM ring journal
+// Based on Maxim DS1307 datasheet, 2008
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "DS1307Journal.h"
+
+/** Journal constructor.
+ * The journal occupies slots * (payloadLength + DS1307JOURNAL_OVERHEAD) bytes
+ * of DS1307 RAM starting at offset. With two or more slots, a record torn by
+ * power loss mid-write fails its CRC and the previous record is recovered.
+ * @param rtc DS1307 object providing RAM access
+ * @param offset First RAM byte used by the journal (0-55)
+ * @param payloadLength Bytes of user data per record (1-DS1307JOURNAL_MAX_PAYLOAD)
+ * @param slots Number of records kept in the ring (2 or more recommended)
+ * @see DS1307JOURNAL_MAX_PAYLOAD
+ */
+DS1307Journal::DS1307Journal(DS1307 *rtc, uint8_t offset, uint8_t payloadLength, uint8_t slots) {
+    this -> rtc = rtc;
+    this -> offset = offset;
+    this -> payloadLength = min(payloadLength, DS1307JOURNAL_MAX_PAYLOAD);
+    this -> slots = slots;
+    slot = 0;
+    sequence = 0;
+    valid = false;
+}
+
+/** Scan all slots and locate the most recent valid record.
+ * Each slot is read in a single burst. This only needs to happen once, at
+ * startup; append() and getLatest() keep track of the ring afterwards.
+ * @return True if a valid record was found, false if the journal is empty
+ *         (or the region does not fit in RAM)
+ */
+bool DS1307Journal::initialize() {
+    uint8_t length = payloadLength + DS1307JOURNAL_OVERHEAD;
+    valid = false;
+    slot = slots - 1; // so an empty journal starts appending at slot 0
+    sequence = 0;
+    if (payloadLength == 0 || slots == 0 || (uint16_t)offset + (uint16_t)slots * length > DS1307_RAM_LENGTH) return false;
+
+    uint8_t latest[DS1307JOURNAL_MAX_RECORD];
+    for (uint8_t i = 0; i < slots; i++) {
+        if (!rtc -> getMemoryBytes(offset + i * length, length, record)) continue;
+        if (crc8(record, length - 1) != record[length - 1]) continue;
+
+        // serial number arithmetic, so the sequence may wrap past 255
+        if (!valid || (int8_t)(record[0] - sequence) > 0) {
+            valid = true;
+            slot = i;
+            sequence = record[0];
+            memcpy(latest, record, length);
+        }
+    }
+    if (valid) memcpy(record, latest, length);
+    return valid;
+}
+
+/** Append a record to the next slot in the ring.
+ * The sequence number, payload and CRC are written in a single transaction.
+ * @param payload payloadLength bytes of data to store
+ * @return True if the record was written, false otherwise
+ */
+bool DS1307Journal::append(const uint8_t *payload) {
+    uint8_t length = payloadLength + DS1307JOURNAL_OVERHEAD;
+    if (slots == 0) return false;
+    uint8_t next = (slot + 1) % slots;
+
+    record[0] = sequence + 1;
+    memcpy(record + 1, payload, payloadLength);
+    record[length - 1] = crc8(record, length - 1);
+    if (!rtc -> setMemoryBytes(offset + next * length, length, record)) {
+        valid = false; // cached record no longer matches RAM, rescan on next read
+        return false;
+    }
+    slot = next;
+    sequence = record[0];
+    valid = true;
+    return true;
+}
+
+/** Get the payload of the most recent valid record.
+ * Served from the local copy kept by initialize() and append(), so this does
+ * not touch the bus unless the last append() failed.
+ * @param payload Buffer for payloadLength bytes of data
+ * @return True if a valid record exists, false otherwise
+ */
+bool DS1307Journal::getLatest(uint8_t *payload) {
+    if (!valid && !initialize()) return false;
+    memcpy(payload, record + 1, payloadLength);
+    return true;
+}
+
+/** Get the sequence number of the most recent valid record.
+ * @return Sequence number (wraps from 255 to 0)
+ */
+uint8_t DS1307Journal::getSequence() {
+    return sequence;
+}
+
+/** Erase all journal slots.
+ * @return True if the region was cleared, false otherwise
+ */
+bool DS1307Journal::clear() {
+    uint8_t length = payloadLength + DS1307JOURNAL_OVERHEAD;
+    memset(record, 0, length - 1);
+    record[length - 1] = ~crc8(record, length - 1); // deliberately invalid
+    for (uint8_t i = 0; i < slots; i++) {
+        if (!rtc -> setMemoryBytes(offset + i * length, length, record)) return false;
+    }
+    valid = false;
+    slot = slots - 1;
+    sequence = 0;
+    return true;
+}
+
+/** CRC-8 (polynomial 0x07, initial value 0xFF) over a block of bytes.
+ * @param data Buffer to checksum
+ * @param length Number of bytes in buffer
+ * @return CRC-8 value
+ */
+uint8_t DS1307Journal::crc8(const uint8_t *data, uint8_t length) {
+    uint8_t crc = 0xFF;
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    return crc;
+}
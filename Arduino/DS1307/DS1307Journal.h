@@ -0,0 +1,68 @@
+// I2Cdev library collection - DS1307 battery-backed RAM ring journal header file
+// Based on Maxim DS1307 datasheet, 2008
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _DS1307JOURNAL_H_
+#define _DS1307JOURNAL_H_
+
+#include "DS1307.h"
+
+// Each record is [SEQUENCE] [PAYLOAD...] [CRC-8], written in one transaction
+#define DS1307JOURNAL_OVERHEAD      2
+#define DS1307JOURNAL_MAX_RECORD    DS1307_RAM_BURST_LENGTH
+#define DS1307JOURNAL_MAX_PAYLOAD   (DS1307JOURNAL_MAX_RECORD - DS1307JOURNAL_OVERHEAD)
+
+class DS1307Journal {
+    public:
+        DS1307Journal(DS1307 *rtc, uint8_t offset, uint8_t payloadLength, uint8_t slots);
+
+        bool initialize();
+        bool append(const uint8_t *payload);
+        bool getLatest(uint8_t *payload);
+        uint8_t getSequence();
+        bool clear();
+
+    private:
+        DS1307 *rtc;
+        uint8_t offset;
+        uint8_t payloadLength;
+        uint8_t slots;
+        uint8_t slot;       // slot holding the latest valid record
+        uint8_t sequence;   // sequence number of the latest valid record
+        bool valid;
+        uint8_t record[DS1307JOURNAL_MAX_RECORD];
+
+        static uint8_t crc8(const uint8_t *data, uint8_t length);
+};
+
+#endif /* _DS1307JOURNAL_H_ */
@@ -0,0 +1,153 @@
+// I2Cdev library collection - DS1307 square-wave disciplined timestamp
+// Based on Maxim DS1307 datasheet, 2008
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "DS1307Timestamp.h"
+
+/** Timestamp service constructor.
+ * @param rtc Initialized DS1307 object whose SQW/OUT pin drives the interrupt
+ */
+DS1307Timestamp::DS1307Timestamp(DS1307 *rtc) {
+    this -> rtc = rtc;
+    edgesPerSecond = 1;
+}
+
+/** Enable the square-wave output and start counting from the current RTC time.
+ * The SQW/OUT pin is open-drain and needs a pull-up. Attach an interrupt on
+ * one edge of that pin that calls handleSquareWaveEdge(). Higher rates give
+ * the same discipline once per RTC second, but cost one (very short)
+ * interrupt per edge, so DS1307_SQW_RATE_1 is the right choice unless the
+ * pin is shared with something that needs the faster clock.
+ * @param rate Square-wave rate (DS1307_SQW_RATE_1/4096/8192/32768)
+ * @return True if the RTC time was read, false otherwise
+ * @see DS1307_SQW_RATE_1
+ */
+bool DS1307Timestamp::initialize(uint8_t rate) {
+    switch (rate) {
+        case DS1307_SQW_RATE_4096: edgesPerSecond = 4096; break;
+        case DS1307_SQW_RATE_8192: edgesPerSecond = 8192; break;
+        case DS1307_SQW_RATE_32768: edgesPerSecond = 32768; break;
+        default: rate = DS1307_SQW_RATE_1; edgesPerSecond = 1; break;
+    }
+
+    baseSeconds = rtc -> getUnixTime();
+    rtc -> setSquareWaveRate(rate);
+    rtc -> setSquareWaveEnabled(true);
+
+    noInterrupts();
+    edgeCountdown = edgesPerSecond;
+    edgeSeconds = 0;
+    edgeMicros = micros();
+    localSecond = DS1307TIMESTAMP_NOMINAL_SECOND;
+    interrupts();
+
+    lastSeconds = baseSeconds;
+    lastMicroseconds = 0;
+    return baseSeconds != 0;
+}
+
+/** Count one square-wave edge. Call this from the SQW/OUT interrupt handler.
+ * Only every edgesPerSecond'th call does any real work: it latches micros()
+ * and measures how many local microseconds the last RTC second took.
+ */
+void DS1307Timestamp::handleSquareWaveEdge() {
+    if (--edgeCountdown) return;
+    edgeCountdown = edgesPerSecond;
+
+    uint32_t now = micros();
+    uint32_t measured = now - edgeMicros;
+    edgeMicros = now;
+    edgeSeconds++;
+
+    // ignore missed or spurious edges (anything more than ~3% off nominal),
+    // and low-pass the rest to hide micros() granularity and ISR latency
+    if (measured > DS1307TIMESTAMP_NOMINAL_SECOND - 32768 && measured < DS1307TIMESTAMP_NOMINAL_SECOND + 32768) {
+        localSecond += ((int32_t)(measured - localSecond)) / 4;
+    }
+}
+
+/** Get a monotonic timestamp without any I2C traffic.
+ * Whole seconds come from counted square-wave edges on top of the RTC time
+ * read in initialize(); the fraction is interpolated from micros() scaled by
+ * the measured local clock rate. The seconds boundary follows the SQW edges,
+ * so it may be offset from the RTC seconds register rollover by a constant
+ * amount under one second. Successive calls never go backwards.
+ * @param seconds Seconds since 1970-01-01 00:00:00
+ * @param microseconds Microseconds into the current second (0-999999)
+ */
+void DS1307Timestamp::getTimestamp(uint32_t *seconds, uint32_t *microseconds) {
+    noInterrupts();
+    uint32_t s = edgeSeconds;
+    uint32_t edge = edgeMicros;
+    uint32_t local = localSecond;
+    interrupts();
+
+    // convert local elapsed time since the last edge to RTC microseconds
+    uint32_t elapsed = micros() - edge;
+    uint32_t scaled = (uint32_t)((float)elapsed * ((float)DS1307TIMESTAMP_NOMINAL_SECOND / (float)local));
+    s += baseSeconds + scaled / 1000000;
+    uint32_t us = scaled % 1000000;
+
+    if (s < lastSeconds || (s == lastSeconds && us < lastMicroseconds)) {
+        // a late edge just pulled the estimate back, hold until it catches up
+        s = lastSeconds;
+        us = lastMicroseconds;
+    }
+    lastSeconds = s;
+    lastMicroseconds = us;
+    *seconds = s;
+    *microseconds = us;
+}
+
+/** Get disciplined microseconds since initialize().
+ * Wraps every ~71 minutes, same as the Arduino micros() function.
+ * @return Microseconds since initialize()
+ * @see getTimestamp()
+ */
+uint32_t DS1307Timestamp::getMicros() {
+    uint32_t s, us;
+    getTimestamp(&s, &us);
+    return (s - baseSeconds) * 1000000 + us;
+}
+
+/** Get the measured length of one RTC second in local micros() ticks.
+ * Useful to check local oscillator error, e.g. 1000250 means the local clock
+ * runs 250ppm fast relative to the RTC crystal.
+ * @return Local microseconds per RTC second
+ */
+uint32_t DS1307Timestamp::getLocalSecond() {
+    noInterrupts();
+    uint32_t local = localSecond;
+    interrupts();
+    return local;
+}
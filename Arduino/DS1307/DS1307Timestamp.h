@@ -0,0 +1,70 @@
+// I2Cdev library collection - DS1307 square-wave disciplined timestamp header file
+// Based on Maxim DS1307 datasheet, 2008
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _DS1307TIMESTAMP_H_
+#define _DS1307TIMESTAMP_H_
+
+#include "DS1307.h"
+
+#define DS1307TIMESTAMP_NOMINAL_SECOND  1000000UL // local micros() per RTC second, before discipline
+
+class DS1307Timestamp {
+    public:
+        DS1307Timestamp(DS1307 *rtc);
+
+        bool initialize(uint8_t rate=DS1307_SQW_RATE_1);
+
+        // call from the interrupt handler attached to the SQW/OUT pin
+        void handleSquareWaveEdge();
+
+        void getTimestamp(uint32_t *seconds, uint32_t *microseconds);
+        uint32_t getMicros();
+        uint32_t getLocalSecond();
+
+    private:
+        DS1307 *rtc;
+        uint16_t edgesPerSecond;
+
+        // updated from interrupt context
+        volatile uint16_t edgeCountdown;
+        volatile uint32_t edgeSeconds;
+        volatile uint32_t edgeMicros;
+        volatile uint32_t localSecond;
+
+        uint32_t baseSeconds;
+        uint32_t lastSeconds;
+        uint32_t lastMicroseconds;
+};
+
+#endif /* _DS1307TIMESTAMP_H_ */
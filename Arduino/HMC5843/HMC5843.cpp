@@ -32,11 +32,16 @@ THE SOFTWARE.
 
 #include "HMC5843.h"
 
+// MotionSample scale per gain setting: 100 / (LSB per gauss) uT, as the nearest power of two
+static const int8_t sampleScales[] = { -4, -4, -3, -3, -2, -2, -2, -1 };
+
 /** Default constructor, uses default I2C address.
  * @see HMC5843_DEFAULT_ADDRESS
  */
 HMC5843::HMC5843() {
     devAddr = HMC5843_DEFAULT_ADDRESS;
+    sampleScale = sampleScales[HMC5843_GAIN_1300];
+    sampleSequence = 0;
 }
 
 /** Specific address constructor.
@@ -46,6 +51,8 @@ HMC5843::HMC5843() {
  */
 HMC5843::HMC5843(uint8_t address) {
     devAddr = address;
+    sampleScale = sampleScales[HMC5843_GAIN_1300];
+    sampleSequence = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -181,6 +188,7 @@ void HMC5843::setGain(uint8_t gain) {
     // requirement specified in the datasheet; it's actually more efficient than
     // using the I2Cdev.writeBits method
     I2Cdev::writeByte(devAddr, HMC5843_RA_CONFIG_B, gain << (HMC5843_CRB_GAIN_BIT - HMC5843_CRB_GAIN_LENGTH + 1));
+    sampleScale = sampleScales[gain & 0x07];
 }
 
 // MODE register
@@ -251,6 +259,24 @@ void HMC5843::getHeading(int16_t *x, int16_t *y, int16_t *z) {
     *y = (((int16_t)buffer[2]) << 8) | buffer[3];
     *z = (((int16_t)buffer[4]) << 8) | buffer[5];
 }
+/** Get the current heading as a MotionSample.
+ * Reads through getHeading() straight into the caller's buffer (and so also
+ * triggers the next single measurement in single mode).
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer
+ * @return Number of samples written (0 or 1)
+ * @see getHeading()
+ * @see MotionSample
+ */
+uint8_t HMC5843::getSamples(MotionSample *samples, uint8_t maxSamples) {
+    if (maxSamples == 0) return 0;
+    getHeading(&samples -> x, &samples -> y, &samples -> z);
+    samples -> timestamp = micros();
+    samples -> sequence = sampleSequence++;
+    samples -> type = MOTION_SAMPLE_MAG;
+    samples -> scale = sampleScale;
+    return 1;
+}
 /** Get X-axis heading measurement.
  * @return 16-bit signed integer with X-axis heading
  * @see HMC5843_RA_DATAX_H
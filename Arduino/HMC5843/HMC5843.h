@@ -34,6 +34,7 @@ THE SOFTWARE.
 #define _HMC5843_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 #define HMC5843_ADDRESS            0x1E // this device only has one address
 #define HMC5843_DEFAULT_ADDRESS    0x1E
@@ -166,6 +167,7 @@ class HMC5843 {
         int16_t getHeadingX();
         int16_t getHeadingY();
         int16_t getHeadingZ();
+        uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
 
         // STATUS register
         bool getRegulatorEnabledStatus();
@@ -180,6 +182,8 @@ class HMC5843 {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        int8_t sampleScale;
+        uint16_t sampleSequence;
         uint8_t mode;
 };
 
@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - add DRDY-gated continuous streaming with pointer-wrap reads
 //     2012-06-12 - fixed swapped Y/Z axes
 //     2011-08-22 - small Doxygen comment fixes
 //     2011-07-31 - initial release
@@ -34,11 +35,18 @@ THE SOFTWARE.
 
 #include "HMC5883L.h"
 
+// MotionSample scale per gain setting: 100 / (LSB per gauss) uT, as the nearest power of two
+static const int8_t sampleScales[] = { -4, -3, -3, -3, -2, -2, -2, -1 };
+
 /** Default constructor, uses default I2C address.
  * @see HMC5883L_DEFAULT_ADDRESS
  */
 HMC5883L::HMC5883L() {
     devAddr = HMC5883L_DEFAULT_ADDRESS;
+    sampleScale = sampleScales[HMC5883L_GAIN_1090];
+    sampleSequence = 0;
+    streamPeriod = 66667;
+    streamLast = 0;
 }
 
 /** Specific address constructor.
@@ -48,6 +56,10 @@ HMC5883L::HMC5883L() {
  */
 HMC5883L::HMC5883L(uint8_t address) {
     devAddr = address;
+    sampleScale = sampleScales[HMC5883L_GAIN_1090];
+    sampleSequence = 0;
+    streamPeriod = 66667;
+    streamLast = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -206,6 +218,7 @@ void HMC5883L::setGain(uint8_t gain) {
     // requirement specified in the datasheet; it's actually more efficient than
     // using the I2Cdev.writeBits method
     I2Cdev::writeByte(devAddr, HMC5883L_RA_CONFIG_B, gain << (HMC5883L_CRB_GAIN_BIT - HMC5883L_CRB_GAIN_LENGTH + 1));
+    sampleScale = sampleScales[gain & 0x07];
 }
 
 // MODE register
@@ -274,6 +287,31 @@ void HMC5883L::getHeading(int16_t *x, int16_t *y, int16_t *z) {
     *y = (((int16_t)buffer[4]) << 8) | buffer[5];
     *z = (((int16_t)buffer[2]) << 8) | buffer[3];
 }
+/** Get the current heading as a MotionSample.
+ * In continuous mode this goes through getHeadingStreamPolled() and so only
+ * returns a sample once a new one is due; otherwise it reads through
+ * getHeading(). Either way the axes are decoded straight into the caller's
+ * buffer.
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer
+ * @return Number of samples written (0 or 1)
+ * @see getHeading()
+ * @see getHeadingStreamPolled()
+ * @see MotionSample
+ */
+uint8_t HMC5883L::getSamples(MotionSample *samples, uint8_t maxSamples) {
+    if (maxSamples == 0) return 0;
+    if (mode == HMC5883L_MODE_CONTINUOUS) {
+        if (!getHeadingStreamPolled(&samples -> x, &samples -> y, &samples -> z)) return 0;
+    } else {
+        getHeading(&samples -> x, &samples -> y, &samples -> z);
+    }
+    samples -> timestamp = micros();
+    samples -> sequence = sampleSequence++;
+    samples -> type = MOTION_SAMPLE_MAG;
+    samples -> scale = sampleScale;
+    return 1;
+}
 /** Get X-axis heading measurement.
  * @return 16-bit signed integer with X-axis heading
  * @see HMC5883L_RA_DATAX_H
@@ -308,6 +346,77 @@ int16_t HMC5883L::getHeadingZ() {
     return (((int16_t)buffer[2]) << 8) | buffer[3];
 }
 
+// continuous streaming
+
+// typical continuous-mode sample periods in microseconds, indexed by data rate
+static const uint32_t streamPeriods[] = { 1333333, 666667, 333333, 133333, 66667, 33333, 13333 };
+
+/** Start continuous measurement for streaming reads.
+ * Sets the data output rate, switches to continuous measurement mode and
+ * leaves the register pointer on DATAX_H. From then on the device rolls its
+ * pointer from DATAY_L back to DATAX_H after every 6-byte read, so each
+ * sample can be fetched with getHeadingStream() as a bare read with no
+ * register address write in front of it.
+ * @param rate New data output rate (0-6, HMC5883L_RATE_75 for fastest)
+ * @see getHeadingStream()
+ * @see getHeadingStreamPolled()
+ * @see HMC5883L_RATE_75
+ * @see HMC5883L_MODE_CONTINUOUS
+ */
+void HMC5883L::initializeContinuous(uint8_t rate) {
+    if (rate > HMC5883L_RATE_75) rate = HMC5883L_RATE_75;
+    setDataRate(rate);
+    setMode(HMC5883L_MODE_CONTINUOUS);
+    I2Cdev::writeBytes(devAddr, HMC5883L_RA_DATAX_H, 0, buffer); // address only, to park the pointer
+    streamPeriod = streamPeriods[rate];
+    streamLast = micros();
+}
+/** Get 3-axis heading from the continuous stream with a bare read.
+ * Call this when the DRDY pin signals new data (it pulses low for 250us when
+ * the data output registers are updated, so attach a FALLING interrupt). The
+ * read does not write a register address, relying on the pointer left on
+ * DATAX_H by initializeContinuous() or the previous read.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return True if a sample was read, false otherwise
+ * @see initializeContinuous()
+ */
+bool HMC5883L::getHeadingStream(int16_t *x, int16_t *y, int16_t *z) {
+    if (I2Cdev::readRawBytes(devAddr, 6, buffer) != 6) return false;
+    streamLast = micros();
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *z = (((int16_t)buffer[2]) << 8) | buffer[3];
+    return true;
+}
+/** Get 3-axis heading from the continuous stream when no DRDY pin is wired.
+ * Nothing is sent on the bus until one sample period has passed since the
+ * last sample. After that, getReadyStatus() gates the read. Checking STATUS
+ * moves the register pointer, so the data read that follows addresses
+ * DATAX_H explicitly. When the data is not ready yet, the pointer is parked
+ * on DATAX_H again so getHeadingStream() keeps working.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return True if a new sample was read, false if none was available yet
+ * @see initializeContinuous()
+ * @see getReadyStatus()
+ */
+bool HMC5883L::getHeadingStreamPolled(int16_t *x, int16_t *y, int16_t *z) {
+    if (micros() - streamLast < streamPeriod) return false;
+    if (!getReadyStatus()) {
+        I2Cdev::writeBytes(devAddr, HMC5883L_RA_DATAX_H, 0, buffer);
+        return false;
+    }
+    if (I2Cdev::readBytes(devAddr, HMC5883L_RA_DATAX_H, 6, buffer) != 6) return false;
+    streamLast = micros();
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *z = (((int16_t)buffer[2]) << 8) | buffer[3];
+    return true;
+}
+
 // STATUS register
 
 /** Get data output register lock status.
@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - add DRDY-gated continuous streaming with pointer-wrap reads
 //     2012-06-12 - fixed swapped Y/Z axes
 //     2011-08-22 - small Doxygen comment fixes
 //     2011-07-31 - initial release
@@ -36,6 +37,7 @@ THE SOFTWARE.
 #define _HMC5883L_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 #define HMC5883L_ADDRESS            0x1E // this device only has one address
 #define HMC5883L_DEFAULT_ADDRESS    0x1E
@@ -129,6 +131,12 @@ class HMC5883L {
         int16_t getHeadingX();
         int16_t getHeadingY();
         int16_t getHeadingZ();
+        uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
+
+        // continuous streaming
+        void initializeContinuous(uint8_t rate);
+        bool getHeadingStream(int16_t *x, int16_t *y, int16_t *z);
+        bool getHeadingStreamPolled(int16_t *x, int16_t *y, int16_t *z);
 
         // STATUS register
         bool getLockStatus();
@@ -142,7 +150,11 @@ class HMC5883L {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        int8_t sampleScale;
+        uint16_t sampleSequence;
         uint8_t mode;
+        uint32_t streamPeriod;  // microseconds between continuous-mode samples
+        uint32_t streamLast;    // micros() of the last streamed sample
 };
 
 #endif /* _HMC5883L_H_ */
@@ -3,6 +3,7 @@
 // 6/9/2012 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - add readRawBytes for devices that read without a register address
 //      2013-05-06 - add Francesco Ferrara's Fastwire v0.24 implementation with small modifications
 //      2013-05-05 - fix issue with writing bit values to words (Sasquatch/Farzanegan)
 //      2012-06-09 - fix major issue with reading > 32 bytes at a time with Arduino Wire
@@ -467,6 +468,74 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
     return count;
 }
 
+/** Read multiple bytes without writing a register address first.
+ * For devices that have no register pointer at all, or whose pointer is
+ * already where it needs to be (e.g. devices that roll their pointer back to
+ * the first data register after the last one is read). This is a single read
+ * transaction, so the device decides where the data starts.
+ * @param devAddr I2C slave device address
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int8_t I2Cdev::readRawBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") reading ");
+        Serial.print(length, DEC);
+        Serial.print(" bytes...");
+    #endif
+
+    int8_t count = 0;
+    uint32_t t1 = millis();
+
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
+
+        // I2C/TWI subsystem uses internal buffer that breaks with large data requests
+        // so if user requests more than BUFFER_LENGTH bytes, we have to do it in
+        // smaller chunks instead of all at once (each chunk is a new transaction)
+        for (uint8_t k = 0; k < length; k += min(length, BUFFER_LENGTH)) {
+            Wire.requestFrom(devAddr, (uint8_t)min(length - k, BUFFER_LENGTH));
+            for (; Wire.available() && (timeout == 0 || millis() - t1 < timeout); count++) {
+                #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
+                    data[count] = Wire.receive();
+                #else
+                    data[count] = Wire.read();
+                #endif
+                #ifdef I2CDEV_SERIAL_DEBUG
+                    Serial.print(data[count], HEX);
+                    if (count + 1 < length) Serial.print(" ");
+                #endif
+            }
+        }
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
+
+        // Fastwire library
+        // no loop required for fastwire
+        uint8_t status = Fastwire::readRaw(devAddr << 1, data, length);
+        if (status == 0) {
+            count = length; // success
+        } else {
+            count = -1; // error
+        }
+
+    #endif
+
+    // check for timeout
+    if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
+
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print(". Done (");
+        Serial.print(count, DEC);
+        Serial.println(" read).");
+    #endif
+
+    return count;
+}
+
 /** write a single bit in an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
@@ -844,6 +913,14 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
 
         /***/
 
+        return readRaw(device, data, num);
+    }
+
+    // read without sending a register address first
+    // (takes 8-bit device address like readBuf: 0xD0, not 0x68)
+    byte Fastwire::readRaw(byte device, byte *data, byte num) {
+        byte twst, retry;
+
         retry = 2;
         do {
             TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO) | (1 << TWSTA);
@@ -0,0 +1,81 @@
+// I2Cdev library collection - Common timestamped motion sample type
+// Based on the accel/gyro/compass drivers in this collection
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MOTIONSAMPLE_H_
+#define _MOTIONSAMPLE_H_
+
+#ifdef ARDUINO
+    #if ARDUINO < 100
+        #include "WProgram.h"
+    #else
+        #include "Arduino.h"
+    #endif
+#else
+    #include <stdint.h>
+#endif
+
+#define MOTION_SAMPLE_ACCEL     0   // scale unit: g
+#define MOTION_SAMPLE_GYRO      1   // scale unit: deg/s
+#define MOTION_SAMPLE_MAG       2   // scale unit: uT
+
+/** One 3-axis reading in the sensor's raw counts.
+ * Filled in place by each motion driver's getSamples(), so a pipeline can
+ * batch any mix of sensors from one array. Fields are ordered so there is no
+ * padding between them; x, y and z are always contiguous.
+ *
+ * scale is the power of two nearest to the weight of one count at the
+ * driver's current range. It is exact for the accelerometers. For gyros and
+ * compasses whose datasheet sensitivity is not a power of two it can be off
+ * by up to a factor of sqrt(2) (~41%; HMC5843 gain 7 is 40% off), so apply
+ * the driver's exact sensitivity where that matters.
+ *
+ * Every driver stamps timestamp with micros() right after the data read
+ * completes; FIFO readers give that time to the newest sample and back-date
+ * older ones by the output period.
+ */
+struct MotionSample {
+    uint32_t timestamp;     // micros() after the data read (newest FIFO entry)
+    uint16_t sequence;      // per-driver running count; gaps mean lost samples
+    uint8_t type;           // MOTION_SAMPLE_ACCEL, MOTION_SAMPLE_GYRO or MOTION_SAMPLE_MAG
+    int8_t scale;           // one count ~= 2^scale units
+    int16_t x;
+    int16_t y;
+    int16_t z;
+};
+
+// distance between consecutive x fields in int16_t units, for FIFO readers
+// that decode straight into a MotionSample array
+#define MOTION_SAMPLE_STRIDE    (sizeof(MotionSample) / sizeof(int16_t))
+
+#endif /* _MOTIONSAMPLE_H_ */
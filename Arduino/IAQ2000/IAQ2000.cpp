@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2012-04-01 - initial release
+//     2026-10-19 - use I2Cdev::readRawBytes, add full 9-byte frame read
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -71,56 +72,35 @@ bool IAQ2000::testConnection() {
 }
 
 /** Read iAQ-2000 indoor air quality sensor.
+ * The device has no register pointer, so this is a plain 2-byte read that
+ * returns the DATA1 and DATA2 bytes.
  * @return Predicted CO2 concentration based on human induced volatile organic compounds (VOC) detection (in ppm VOC + CO2 equivalents)
+ * @see getFrame()
  */
 uint16_t IAQ2000::getIaq() {
   // read bytes from the DATA1 AND DATA2 registers and bit-shifting them into a 16-bit value
-  readAllBytes(devAddr, 2, buffer);
-  return ((buffer[0] << 8) | buffer[1]);
+  I2Cdev::readRawBytes(devAddr, 2, buffer);
+  return (((uint16_t)buffer[0]) << 8) | buffer[1];
 }
 
-/**  Read bytes from a slave device.
- * This is a "stripped-down" version of the standard Jeff Rowberg's I2Cdev::readBytes method
- * intended to provide compatibility with iAQ-2000,
- * which apparently does not support setting of an address pointer to indicate from which position is to start read from.
- * @param devAddr Address of the slave device to read bytes from
- * @param length Number of bytes to read
- * @param data Buffer to store read data in
- * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Number of bytes read (0 indicates failure)
+/** Read the complete 9-byte data frame in a single transaction.
+ * Frame layout: CO2 prediction (2 bytes), status (1 byte), sensor
+ * resistance (4 bytes) and TVOC prediction (2 bytes), all MSB first.
+ * Reading everything at once keeps the values consistent with each other.
+ * Any output pointer may be 0 if the value is not needed.
+ * @param iaq Predicted CO2 equivalent in ppm
+ * @param status Frame status (IAQ2000_STATUS_OK, _BUSY, _RUNIN or _ERROR)
+ * @param resistance Sensor resistance in Ohm
+ * @param tvoc Predicted TVOC equivalent in ppb
+ * @return True if the whole frame was read, false otherwise
+ * @see IAQ2000_FRAME_LENGTH
  */
-int8_t IAQ2000::readAllBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-#ifdef I2CDEV_SERIAL_DEBUG
-    Serial.print("I2C (0x");
-    Serial.print(devAddr, HEX);
-    Serial.print(") reading ");
-    Serial.print(length, DEC);
-    Serial.print(" bytes...");
-#endif
-    
-    int8_t count = 0;
-
-    Wire.requestFrom(devAddr, length);
-    
-    uint32_t t1 = millis();
-    for (; Wire.available() && (timeout == 0 || millis() - t1 < timeout); count++) {
-#if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
-        data[count] = Wire.receive();
-#elif (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100)
-        data[count] = Wire.read();
-#endif
-#ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print(data[count], HEX);
-        if (count + 1 < length) Serial.print(" ");
-#endif
-    }
-    if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
-    
-#ifdef I2CDEV_SERIAL_DEBUG
-    Serial.print(". Done (");
-    Serial.print(count, DEC);
-    Serial.println(" read).");
-#endif
-    
-    return count;
+bool IAQ2000::getFrame(uint16_t *iaq, uint8_t *status, uint32_t *resistance, uint16_t *tvoc) {
+    if (I2Cdev::readRawBytes(devAddr, IAQ2000_FRAME_LENGTH, buffer) != IAQ2000_FRAME_LENGTH) return false;
+    if (iaq) *iaq = (((uint16_t)buffer[0]) << 8) | buffer[1];
+    if (status) *status = buffer[2];
+    if (resistance) *resistance = (((uint32_t)buffer[3]) << 24) | (((uint32_t)buffer[4]) << 16)
+                                | (((uint32_t)buffer[5]) << 8) | buffer[6];
+    if (tvoc) *tvoc = (((uint16_t)buffer[7]) << 8) | buffer[8];
+    return true;
 }
@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2012-04-01 - initial release
+//     2026-10-19 - use I2Cdev::readRawBytes, add full 9-byte frame read
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -43,6 +44,13 @@ THE SOFTWARE.
 #define IAQ2000_RA_DATA1 0x00
 #define IAQ2000_RA_DATA2 0x01
 
+#define IAQ2000_FRAME_LENGTH        9
+
+#define IAQ2000_STATUS_OK           0x00
+#define IAQ2000_STATUS_BUSY         0x01
+#define IAQ2000_STATUS_RUNIN        0x10
+#define IAQ2000_STATUS_ERROR        0x80
+
 class IAQ2000 {
     public:
         IAQ2000();
@@ -50,12 +58,11 @@ class IAQ2000 {
         void initialize();
 		bool testConnection();
         uint16_t getIaq();
+        bool getFrame(uint16_t *iaq, uint8_t *status, uint32_t *resistance, uint16_t *tvoc);
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[2];
-    
-        int8_t readAllBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        uint8_t buffer[IAQ2000_FRAME_LENGTH];
 };
 
 #endif /* _IAQ200_H_ */
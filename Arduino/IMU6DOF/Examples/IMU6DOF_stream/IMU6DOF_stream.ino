@@ -0,0 +1,94 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for IMU6DOF class
+// 10/19/2026
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Streams aligned gyro/accel frames from an ITG3200 + ADXL345 board (e.g. the
+// SparkFun 6DOF stick), clocked by the ITG3200 data-ready interrupt. Wire the
+// ITG3200 INT pin to Arduino digital pin 2 (external interrupt 0).
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev, ITG3200, ADXL345 and IMU6DOF must be installed as libraries, or else
+// the .cpp/.h files for all classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "ITG3200.h"
+#include "ADXL345.h"
+#include "IMU6DOF.h"
+
+ITG3200 gyro;
+ADXL345 accel;
+IMU6DOF imu(&gyro, &accel);
+IMU6DOFFrame frame;
+
+void imuDataReady() {
+    imu.dataReady();
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Serial.begin(115200);
+
+    // initialize devices
+    Serial.println("Initializing I2C devices...");
+    gyro.initialize();
+    accel.initialize();
+    Serial.println(gyro.testConnection() ? "ITG3200 connection successful" : "ITG3200 connection failed");
+    Serial.println(accel.testConnection() ? "ADXL345 connection successful" : "ADXL345 connection failed");
+
+    // 100Hz frames, temperature once a second
+    gyro.setDLPFBandwidth(ITG3200_DLPF_BW_42);
+    imu.initialize(9);
+    imu.setTemperatureInterval(100);
+    attachInterrupt(0, imuDataReady, RISING);
+}
+
+void loop() {
+    if (!imu.getFrame(&frame)) return;
+
+    // display tab-separated timestamp, sequence, gyro x/y/z, accel x/y/z
+    Serial.print(frame.timestamp); Serial.print("\t");
+    Serial.print(frame.sequence); Serial.print("\t");
+    Serial.print(frame.gyro[0]); Serial.print("\t");
+    Serial.print(frame.gyro[1]); Serial.print("\t");
+    Serial.print(frame.gyro[2]); Serial.print("\t");
+    Serial.print(frame.accel[0]); Serial.print("\t");
+    Serial.print(frame.accel[1]); Serial.print("\t");
+    Serial.print(frame.accel[2]);
+    if (frame.temperatureUpdated) {
+        Serial.print("\ttemp:"); Serial.print(frame.temperature);
+    }
+    if (frame.missed) {
+        Serial.print("\tmissed:"); Serial.print(frame.missed);
+    }
+    Serial.println();
+}
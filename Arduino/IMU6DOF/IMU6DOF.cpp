@@ -0,0 +1,157 @@
+// I2Cdev library collection - ITG3200 + ADXL345 synchronized 6-DOF acquisition
+// Based on InvenSense ITG-3200 and Analog Devices ADXL345 datasheets
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "IMU6DOF.h"
+
+/** Constructor.
+ * Both drivers must already be constructed for their bus addresses; the
+ * acquisition object only borrows them.
+ * @param gyro ITG3200 driver, its INT pin is the frame clock
+ * @param accel ADXL345 driver read right after each gyro sample
+ */
+IMU6DOF::IMU6DOF(ITG3200 *gyro, ADXL345 *accel) {
+    this -> gyro = gyro;
+    this -> accel = accel;
+    pending = 0;
+    readyTime = 0;
+    interruptDriven = false;
+    sequence = 0;
+    temperatureInterval = IMU6DOF_DEFAULT_TEMP_INTERVAL;
+    temperatureCountdown = 0;
+    temperature = 0;
+}
+
+/** Configure both sensors for synchronized acquisition.
+ * Call after ITG3200::initialize() and ADXL345::initialize(). The ITG3200
+ * is set to the requested sample rate with a 50us active-high data-ready
+ * pulse on INT, cleared by a status read when polled instead. The ADXL345
+ * FIFO is bypassed and its output rate set to the lowest rate at or above
+ * the gyro rate, so the accelerometer registers always hold a sample no
+ * older than one gyro period when they are read.
+ * @param rateDivider ITG3200 sample rate divider (rate = Fint / (div + 1))
+ * @see ITG3200::setRate()
+ */
+void IMU6DOF::initialize(uint8_t rateDivider) {
+    gyro -> setRate(rateDivider);
+    gyro -> setInterruptMode(ITG3200_INTMODE_ACTIVEHIGH);
+    gyro -> setInterruptDrive(ITG3200_INTDRV_PUSHPULL);
+    gyro -> setInterruptLatch(ITG3200_INTLATCH_50USPULSE);
+    gyro -> setInterruptLatchClear(ITG3200_INTCLEAR_STATUSREAD);
+    gyro -> setIntDataReadyEnabled(true);
+
+    uint16_t internal = gyro -> getDLPFBandwidth() == ITG3200_DLPF_BW_256 ? 8000 : 1000;
+    uint16_t gyroRate = internal / ((uint16_t)rateDivider + 1);
+    uint8_t accelRate = ADXL345_RATE_100;
+    while (accelRate < ADXL345_RATE_3200 && (3200 >> (ADXL345_RATE_3200 - accelRate)) < gyroRate) {
+        accelRate++;
+    }
+    accel -> setFIFOMode(ADXL345_FIFO_MODE_BYPASS);
+    accel -> setRate(accelRate);
+    accel -> setMeasureEnabled(true);
+
+    pending = 0;
+    sequence = 0;
+    temperatureCountdown = 0;
+}
+
+/** Set how often the die temperature is refreshed.
+ * Temperature moves slowly, so reading it with every frame only costs bus
+ * time. The first frame after initialize() always reads it.
+ * @param interval Frames between temperature reads, 0 to never read it
+ */
+void IMU6DOF::setTemperatureInterval(uint8_t interval) {
+    temperatureInterval = interval;
+    if (temperatureCountdown > interval) temperatureCountdown = interval;
+}
+
+/** Record an ITG3200 data-ready edge.
+ * Call from the interrupt handler attached (RISING) to the ITG3200 INT pin.
+ * Only stores the timestamp and counts the edge; no bus traffic happens in
+ * interrupt context. Once called, available() and getFrame() stop polling
+ * the status register.
+ */
+void IMU6DOF::dataReady() {
+    readyTime = micros();
+    if (pending < 255) pending++;
+    interruptDriven = true;
+}
+
+/** Check whether a new gyro sample is waiting.
+ * In polled mode this reads (and so clears) the ITG3200 data-ready status,
+ * and the sample is then treated as pending until getFrame() collects it.
+ * @return True if getFrame() will return a frame
+ */
+bool IMU6DOF::available() {
+    if (pending) return true;
+    if (interruptDriven || !gyro -> getIntDataReadyStatus()) return false;
+    readyTime = micros();
+    pending = 1;
+    return true;
+}
+
+/** Read one aligned 6-DOF frame.
+ * Reads the gyro (plus temperature every setTemperatureInterval() frames)
+ * and then the accelerometer in back-to-back bursts, so both sensors are
+ * sampled within a few hundred microseconds of the gyro data-ready edge.
+ * If several edges arrived since the last call only the latest sample is
+ * still in the registers; the skipped ones are reported in missed and in
+ * the sequence gap.
+ * @param frame Output frame
+ * @return True if a frame was read, false if no new gyro sample is ready
+ */
+bool IMU6DOF::getFrame(IMU6DOFFrame *frame) {
+    if (!available()) return false;
+
+    noInterrupts();
+    uint8_t edges = pending;
+    uint32_t timestamp = readyTime;
+    pending = 0;
+    interrupts();
+
+    frame -> temperatureUpdated = false;
+    if (temperatureInterval && temperatureCountdown-- == 0) {
+        temperature = gyro -> getTemperature();
+        temperatureCountdown = temperatureInterval - 1;
+        frame -> temperatureUpdated = true;
+    }
+    gyro -> getRotation(&frame -> gyro[0], &frame -> gyro[1], &frame -> gyro[2]);
+    accel -> getAcceleration(&frame -> accel[0], &frame -> accel[1], &frame -> accel[2]);
+
+    sequence += edges;
+    frame -> timestamp = timestamp;
+    frame -> sequence = sequence - 1;
+    frame -> missed = edges - 1;
+    frame -> temperature = temperature;
+    return true;
+}
@@ -0,0 +1,79 @@
+// I2Cdev library collection - ITG3200 + ADXL345 synchronized 6-DOF acquisition header file
+// Based on InvenSense ITG-3200 and Analog Devices ADXL345 datasheets
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _IMU6DOF_H_
+#define _IMU6DOF_H_
+
+#include "ITG3200.h"
+#include "ADXL345.h"
+
+#define IMU6DOF_DEFAULT_RATE_DIVIDER    9       // 100Hz with the DLPF enabled
+#define IMU6DOF_DEFAULT_TEMP_INTERVAL   100     // frames between temperature reads
+
+struct IMU6DOFFrame {
+    uint32_t timestamp;         // micros() at the gyro data-ready edge
+    uint16_t sequence;          // gyro sample number, gaps show dropped samples
+    uint8_t missed;             // data-ready edges since the previous frame, minus one
+    bool temperatureUpdated;    // true if temperature was read for this frame
+    int16_t gyro[3];
+    int16_t accel[3];
+    int16_t temperature;        // most recent raw ITG3200 reading
+};
+
+class IMU6DOF {
+    public:
+        IMU6DOF(ITG3200 *gyro, ADXL345 *accel);
+
+        void initialize(uint8_t rateDivider=IMU6DOF_DEFAULT_RATE_DIVIDER);
+        void setTemperatureInterval(uint8_t interval);
+
+        void dataReady();
+        bool available();
+        bool getFrame(IMU6DOFFrame *frame);
+
+    private:
+        ITG3200 *gyro;
+        ADXL345 *accel;
+
+        volatile uint8_t pending;
+        volatile uint32_t readyTime;
+        bool interruptDriven;
+
+        uint16_t sequence;
+        uint8_t temperatureInterval;
+        uint8_t temperatureCountdown;
+        int16_t temperature;
+};
+
+#endif /* _IMU6DOF_H_ */
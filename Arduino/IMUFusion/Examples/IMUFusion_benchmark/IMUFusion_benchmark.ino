@@ -0,0 +1,96 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for IMUFusion class
+// 10/19/2026
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Measures fusion throughput on the target without any sensors attached, so
+// the numbers show how much of the CPU each filter costs at a given sample
+// rate. Build once as-is and once with IMUFUSION_FIXED_POINT defined in
+// IMUFusion.h to compare float and integer builds.
+
+#include "IMUFusion.h"
+
+#define BENCH_SAMPLES 32            // one full FIFO burst
+#define BENCH_ROUNDS  32
+
+IMUFusion fusion;
+
+// a slow tumble: gyro ~0.1 rad/s, gravity tilted, horizontal field
+int16_t gyro[BENCH_SAMPLES * 3];
+int16_t accel[BENCH_SAMPLES * 3];
+int16_t mag[BENCH_SAMPLES * 3];
+
+void bench(const char *name, uint8_t algorithm, const int16_t *m) {
+    Quaternion q;
+    fusion.setAlgorithm(algorithm);
+    fusion.reset();
+
+    uint32_t start = micros();
+    for (uint8_t i = 0; i < BENCH_ROUNDS; i++) {
+        fusion.updateBatch(gyro, accel, m, BENCH_SAMPLES);
+    }
+    uint32_t elapsed = micros() - start;
+    fusion.getQuaternion(&q);
+
+    Serial.print(name);
+    Serial.print(":\t");
+    Serial.print(elapsed / (BENCH_ROUNDS * BENCH_SAMPLES));
+    Serial.print(" us/update\t");
+    Serial.print(1000000.0 * BENCH_ROUNDS * BENCH_SAMPLES / elapsed);
+    Serial.print(" updates/s\tq = ");
+    Serial.print(q.w, 3); Serial.print(" ");
+    Serial.print(q.x, 3); Serial.print(" ");
+    Serial.print(q.y, 3); Serial.print(" ");
+    Serial.println(q.z, 3);
+}
+
+void setup() {
+    Serial.begin(38400);
+
+    for (uint8_t i = 0; i < BENCH_SAMPLES; i++) {
+        gyro[i*3] = 80 + i;  gyro[i*3 + 1] = -40;       gyro[i*3 + 2] = 20;
+        accel[i*3] = 1200;   accel[i*3 + 1] = -800 + i; accel[i*3 + 2] = 16200;
+        mag[i*3] = 210;      mag[i*3 + 1] = 35;         mag[i*3 + 2] = -380;
+    }
+    fusion.setSamplePeriod(0.01f);
+    fusion.setGyroScale(0.001214f); // ITG3200: 1/14.375 deg/s per LSB
+
+    #ifdef IMUFUSION_FIXED_POINT
+        Serial.println("IMUFusion benchmark (fixed point)");
+    #else
+        Serial.println("IMUFusion benchmark (float)");
+    #endif
+    bench("Madgwick 6-axis", IMUFUSION_MADGWICK, 0);
+    bench("Madgwick 9-axis", IMUFUSION_MADGWICK, mag);
+    bench("Mahony 6-axis", IMUFUSION_MAHONY, 0);
+    bench("Mahony 9-axis", IMUFUSION_MAHONY, mag);
+}
+
+void loop() {
+}
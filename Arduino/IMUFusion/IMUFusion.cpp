@@ -0,0 +1,402 @@
+// I2Cdev library collection - Gyro/accel/mag orientation fusion implementation
+// Based on S. Madgwick (2010) gradient descent and R. Mahony (2008) complementary filters
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "IMUFusion.h"
+
+#ifdef IMUFUSION_FIXED_POINT
+    #define FMUL(a, b)  ((imufusion_t)(((int64_t)(a) * (b)) >> IMUFUSION_Q))
+    #define FONE        ((imufusion_t)1 << IMUFUSION_Q)
+    #define FHALF       ((imufusion_t)1 << (IMUFUSION_Q - 1))
+#else
+    #define FMUL(a, b)  ((a) * (b))
+    #define FONE        1.0f
+    #define FHALF       0.5f
+#endif
+
+#ifdef IMUFUSION_FIXED_POINT
+static uint32_t isqrt64(uint64_t v) {
+    uint64_t root = 0, bit = (uint64_t)1 << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static imufusion_t toFixed(float f) {
+    return (imufusion_t)(f * (float)FONE + (f < 0 ? -0.5f : 0.5f));
+}
+#endif
+
+/** Scale a vector to unit length in place.
+ * @param v Vector to normalize
+ * @param n Number of components (3 or 4)
+ * @return False if the vector is zero (left untouched)
+ */
+static bool normalize(imufusion_t *v, uint8_t n) {
+    uint8_t i;
+    #ifdef IMUFUSION_FIXED_POINT
+        uint64_t sum = 0;
+        for (i = 0; i < n; i++) sum += (int64_t)v[i] * v[i];
+        uint32_t norm = isqrt64(sum);
+        if (norm == 0) return false;
+        int64_t inv = ((int64_t)1 << (2 * IMUFUSION_Q)) / norm;
+        for (i = 0; i < n; i++) v[i] = (imufusion_t)(((int64_t)v[i] * inv) >> IMUFUSION_Q);
+    #else
+        float sum = 0;
+        for (i = 0; i < n; i++) sum += v[i] * v[i];
+        if (sum == 0) return false;
+        float inv = 1.0f / sqrt(sum);
+        for (i = 0; i < n; i++) v[i] *= inv;
+    #endif
+    return true;
+}
+
+/** Convert a raw 3-axis reading to a unit vector.
+ * Only the direction of accelerometer and magnetometer readings is used, so
+ * no per-driver scale is needed.
+ * @param raw Raw X, Y, Z counts
+ * @param v Unit vector output
+ * @return False if all three axes are zero
+ */
+static bool normalizeRaw(const int16_t *raw, imufusion_t *v) {
+    #ifdef IMUFUSION_FIXED_POINT
+        uint32_t sum = (uint32_t)((int32_t)raw[0] * raw[0]) + (uint32_t)((int32_t)raw[1] * raw[1]) + (uint32_t)((int32_t)raw[2] * raw[2]);
+        uint32_t norm = isqrt64(sum);
+        if (norm == 0) return false;
+        int64_t inv = ((int64_t)1 << (IMUFUSION_Q + 16)) / norm;
+        for (uint8_t i = 0; i < 3; i++) v[i] = (imufusion_t)((raw[i] * inv) >> 16);
+        return true;
+    #else
+        for (uint8_t i = 0; i < 3; i++) v[i] = raw[i];
+        return normalize(v, 3);
+    #endif
+}
+
+/** Length of a 2D vector. */
+static imufusion_t norm2(imufusion_t x, imufusion_t y) {
+    #ifdef IMUFUSION_FIXED_POINT
+        return isqrt64((uint64_t)((int64_t)x * x + (int64_t)y * y));
+    #else
+        return sqrt(x * x + y * y);
+    #endif
+}
+
+/** Default constructor.
+ * Starts level (identity quaternion) with a 100 Hz sample period, +/-250
+ * deg/s gyro scale and the published default gains of both filters.
+ * @param algorithm IMUFUSION_MADGWICK or IMUFUSION_MAHONY
+ */
+IMUFusion::IMUFusion(uint8_t algorithm) {
+    this -> algorithm = algorithm;
+    period = IMUFUSION_DEFAULT_PERIOD;
+    gyroScale = IMUFUSION_DEFAULT_GYRO_SCALE;
+    beta = IMUFUSION_DEFAULT_BETA;
+    kp = IMUFUSION_DEFAULT_KP;
+    ki = IMUFUSION_DEFAULT_KI;
+    recompute();
+    reset();
+}
+
+/** Return to the identity orientation and clear the integral feedback. */
+void IMUFusion::reset() {
+    q[0] = FONE;
+    q[1] = q[2] = q[3] = 0;
+    integral[0] = integral[1] = integral[2] = 0;
+}
+
+/** Select the filter used by subsequent updates.
+ * The current orientation is kept, so filters can be switched on the fly.
+ * @param algorithm IMUFUSION_MADGWICK or IMUFUSION_MAHONY
+ */
+void IMUFusion::setAlgorithm(uint8_t algorithm) {
+    this -> algorithm = algorithm;
+}
+/** Get the filter used by updates.
+ * @return IMUFUSION_MADGWICK or IMUFUSION_MAHONY
+ */
+uint8_t IMUFusion::getAlgorithm() {
+    return algorithm;
+}
+
+/** Set the time between samples.
+ * Batched FIFO samples are taken at the sensor's output data rate, so this
+ * is normally 1 / ODR rather than the host's polling interval.
+ * @param seconds Sample period in seconds
+ */
+void IMUFusion::setSamplePeriod(float seconds) {
+    period = seconds;
+    recompute();
+}
+/** Set the gyroscope sensitivity.
+ * Use the driver's full-scale setting, e.g. 1/14.375 deg/s for ITG3200,
+ * 8.75 mdps for L3G4200D at 250 dps, 1/131 deg/s for MPU6050 at 250 deg/s,
+ * converted to radians. Gyro axes must follow the accelerometer's axes.
+ * @param radiansPerSecondPerLSB Angular rate of one raw count
+ */
+void IMUFusion::setGyroScale(float radiansPerSecondPerLSB) {
+    gyroScale = radiansPerSecondPerLSB;
+    recompute();
+}
+/** Set the Madgwick gradient step gain.
+ * @param beta Gain in rad/s; larger trusts the accelerometer/magnetometer more
+ */
+void IMUFusion::setBeta(float beta) {
+    this -> beta = beta;
+    recompute();
+}
+/** Set the Mahony proportional and integral gains.
+ * @param kp Proportional gain (1/s)
+ * @param ki Integral gain (1/s^2), 0 to disable gyro bias estimation
+ */
+void IMUFusion::setMahonyGains(float kp, float ki) {
+    this -> kp = kp;
+    this -> ki = ki;
+    integral[0] = integral[1] = integral[2] = 0;
+    recompute();
+}
+
+/** Precompute per-step constants so the update loop has no divisions. */
+void IMUFusion::recompute() {
+    float half = 0.5f * gyroScale * period;
+    #ifdef IMUFUSION_FIXED_POINT
+        gyroFactor = (int32_t)(half * (float)((int64_t)1 << (IMUFUSION_Q + IMUFUSION_GYRO_SHIFT)) + 0.5f);
+        betaDt = toFixed(beta * period);
+        kpDt = toFixed(kp * period);
+        kiDt2 = toFixed(ki * period * period);
+    #else
+        gyroFactor = half;
+        betaDt = beta * period;
+        kpDt = kp * period;
+        kiDt2 = ki * period * period;
+    #endif
+}
+
+/** Fuse one gyro/accel sample.
+ * @param gx Raw gyro X
+ * @param gy Raw gyro Y
+ * @param gz Raw gyro Z
+ * @param ax Raw accel X
+ * @param ay Raw accel Y
+ * @param az Raw accel Z
+ */
+void IMUFusion::update(int16_t gx, int16_t gy, int16_t gz, int16_t ax, int16_t ay, int16_t az) {
+    int16_t g[3] = { gx, gy, gz };
+    int16_t a[3] = { ax, ay, az };
+    step(g, a, 0);
+}
+/** Fuse one gyro/accel/mag sample.
+ * Magnetometer axes must already be aligned with the accelerometer (and
+ * hard/soft-iron corrected, see MagCalibration).
+ * @param gx Raw gyro X
+ * @param gy Raw gyro Y
+ * @param gz Raw gyro Z
+ * @param ax Raw accel X
+ * @param ay Raw accel Y
+ * @param az Raw accel Z
+ * @param mx Raw mag X
+ * @param my Raw mag Y
+ * @param mz Raw mag Z
+ */
+void IMUFusion::update(int16_t gx, int16_t gy, int16_t gz, int16_t ax, int16_t ay, int16_t az, int16_t mx, int16_t my, int16_t mz) {
+    int16_t g[3] = { gx, gy, gz };
+    int16_t a[3] = { ax, ay, az };
+    int16_t m[3] = { mx, my, mz };
+    step(g, a, m);
+}
+/** Fuse a burst of evenly spaced samples.
+ * Arrays are packed x, y, z per sample, as returned by the FIFO readers
+ * (ADXL345::getFIFOAcceleration(), L3G4200D::getFIFOAngularVelocity()).
+ * @param gyro 3 * count raw gyro values
+ * @param accel 3 * count raw accel values
+ * @param mag 3 * count raw mag values, or 0 for 6-axis fusion
+ * @param count Number of samples
+ * @return Number of samples fused
+ */
+uint16_t IMUFusion::updateBatch(const int16_t *gyro, const int16_t *accel, const int16_t *mag, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++, gyro += 3, accel += 3) {
+        step(gyro, accel, mag);
+        if (mag) mag += 3;
+    }
+    return count;
+}
+
+/** Get the current orientation.
+ * @param q Unit quaternion (sensor frame relative to the earth frame)
+ */
+void IMUFusion::getQuaternion(Quaternion *q) {
+    #ifdef IMUFUSION_FIXED_POINT
+        q -> w = (float)this -> q[0] / FONE;
+        q -> x = (float)this -> q[1] / FONE;
+        q -> y = (float)this -> q[2] / FONE;
+        q -> z = (float)this -> q[3] / FONE;
+    #else
+        q -> w = this -> q[0];
+        q -> x = this -> q[1];
+        q -> y = this -> q[2];
+        q -> z = this -> q[3];
+    #endif
+}
+/** Get the current orientation as w, x, y, z in Q2.14 (1.0 = 16384).
+ * Same scale as the MPU6050 DMP quaternion packet.
+ * @param data 4-element output array
+ */
+void IMUFusion::getQuaternion(int16_t *data) {
+    for (uint8_t i = 0; i < 4; i++) {
+        #ifdef IMUFUSION_FIXED_POINT
+            data[i] = q[i] >> (IMUFUSION_Q - 14);
+        #else
+            data[i] = q[i] * 16384.0f;
+        #endif
+    }
+}
+
+void IMUFusion::step(const int16_t *g, const int16_t *a, const int16_t *m) {
+    imufusion_t gx, gy, gz, an[3], mn[3];
+    #ifdef IMUFUSION_FIXED_POINT
+        gx = ((int64_t)g[0] * gyroFactor) >> IMUFUSION_GYRO_SHIFT;
+        gy = ((int64_t)g[1] * gyroFactor) >> IMUFUSION_GYRO_SHIFT;
+        gz = ((int64_t)g[2] * gyroFactor) >> IMUFUSION_GYRO_SHIFT;
+    #else
+        gx = g[0] * gyroFactor;
+        gy = g[1] * gyroFactor;
+        gz = g[2] * gyroFactor;
+    #endif
+
+    if (!normalizeRaw(a, an)) {
+        // no gravity reference (free fall or missing sample): gyro only
+        integrate(gx, gy, gz);
+    } else {
+        bool haveMag = m != 0 && normalizeRaw(m, mn);
+        if (algorithm == IMUFUSION_MAHONY) mahony(gx, gy, gz, an, haveMag ? mn : 0);
+        else madgwick(gx, gy, gz, an, haveMag ? mn : 0);
+    }
+    normalize(q, 4);
+}
+
+/** Advance q by q * (0, g), g being the gyro rate times half the period. */
+void IMUFusion::integrate(imufusion_t gx, imufusion_t gy, imufusion_t gz) {
+    imufusion_t qa = q[0], qb = q[1], qc = q[2], qd = q[3];
+    q[0] += -FMUL(qb, gx) - FMUL(qc, gy) - FMUL(qd, gz);
+    q[1] +=  FMUL(qa, gx) + FMUL(qc, gz) - FMUL(qd, gy);
+    q[2] +=  FMUL(qa, gy) - FMUL(qb, gz) + FMUL(qd, gx);
+    q[3] +=  FMUL(qa, gz) + FMUL(qb, gy) - FMUL(qc, gx);
+}
+
+void IMUFusion::madgwick(imufusion_t gx, imufusion_t gy, imufusion_t gz, const imufusion_t *a, const imufusion_t *m) {
+    imufusion_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    imufusion_t q0q1 = FMUL(q0, q1), q0q2 = FMUL(q0, q2), q0q3 = FMUL(q0, q3);
+    imufusion_t q1q1 = FMUL(q1, q1), q1q2 = FMUL(q1, q2), q1q3 = FMUL(q1, q3);
+    imufusion_t q2q2 = FMUL(q2, q2), q2q3 = FMUL(q2, q3), q3q3 = FMUL(q3, q3);
+    imufusion_t s[4];
+
+    // gradient J'f of the gravity objective function, reference (0, 0, 1)
+    imufusion_t f1 = 2 * (q1q3 - q0q2) - a[0];
+    imufusion_t f2 = 2 * (q0q1 + q2q3) - a[1];
+    imufusion_t f3 = FONE - 2 * (q1q1 + q2q2) - a[2];
+    s[0] = FMUL(-2 * q2, f1) + FMUL(2 * q1, f2);
+    s[1] = FMUL(2 * q3, f1) + FMUL(2 * q0, f2) - FMUL(4 * q1, f3);
+    s[2] = FMUL(-2 * q0, f1) + FMUL(2 * q3, f2) - FMUL(4 * q2, f3);
+    s[3] = FMUL(2 * q1, f1) + FMUL(2 * q2, f2);
+
+    if (m) {
+        // earth-frame field h = q m q*, reference b = (|h.xy|, 0, h.z)
+        imufusion_t hx = FMUL(m[0], FONE - 2 * (q2q2 + q3q3)) + 2 * (FMUL(m[1], q1q2 - q0q3) + FMUL(m[2], q1q3 + q0q2));
+        imufusion_t hy = FMUL(m[1], FONE - 2 * (q1q1 + q3q3)) + 2 * (FMUL(m[0], q1q2 + q0q3) + FMUL(m[2], q2q3 - q0q1));
+        imufusion_t bz = FMUL(m[2], FONE - 2 * (q1q1 + q2q2)) + 2 * (FMUL(m[0], q1q3 - q0q2) + FMUL(m[1], q2q3 + q0q1));
+        imufusion_t bx = norm2(hx, hy);
+        imufusion_t _2bx = 2 * bx, _2bz = 2 * bz, _4bx = 4 * bx, _4bz = 4 * bz;
+
+        imufusion_t f4 = FMUL(_2bx, FHALF - q2q2 - q3q3) + FMUL(_2bz, q1q3 - q0q2) - m[0];
+        imufusion_t f5 = FMUL(_2bx, q1q2 - q0q3) + FMUL(_2bz, q0q1 + q2q3) - m[1];
+        imufusion_t f6 = FMUL(_2bx, q0q2 + q1q3) + FMUL(_2bz, FHALF - q1q1 - q2q2) - m[2];
+        s[0] += -FMUL(FMUL(_2bz, q2), f4) + FMUL(FMUL(_2bz, q1) - FMUL(_2bx, q3), f5) + FMUL(FMUL(_2bx, q2), f6);
+        s[1] += FMUL(FMUL(_2bz, q3), f4) + FMUL(FMUL(_2bx, q2) + FMUL(_2bz, q0), f5) + FMUL(FMUL(_2bx, q3) - FMUL(_4bz, q1), f6);
+        s[2] += -FMUL(FMUL(_4bx, q2) + FMUL(_2bz, q0), f4) + FMUL(FMUL(_2bx, q1) + FMUL(_2bz, q3), f5) + FMUL(FMUL(_2bx, q0) - FMUL(_4bz, q2), f6);
+        s[3] += FMUL(FMUL(_2bz, q1) - FMUL(_4bx, q3), f4) + FMUL(FMUL(_2bz, q2) - FMUL(_2bx, q0), f5) + FMUL(FMUL(_2bx, q1), f6);
+    }
+
+    integrate(gx, gy, gz);
+    if (normalize(s, 4)) {
+        for (uint8_t i = 0; i < 4; i++) q[i] -= FMUL(betaDt, s[i]);
+    }
+}
+
+void IMUFusion::mahony(imufusion_t gx, imufusion_t gy, imufusion_t gz, const imufusion_t *a, const imufusion_t *m) {
+    imufusion_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    imufusion_t q0q0 = FMUL(q0, q0), q0q1 = FMUL(q0, q1), q0q2 = FMUL(q0, q2), q0q3 = FMUL(q0, q3);
+    imufusion_t q1q1 = FMUL(q1, q1), q1q2 = FMUL(q1, q2), q1q3 = FMUL(q1, q3);
+    imufusion_t q2q2 = FMUL(q2, q2), q2q3 = FMUL(q2, q3), q3q3 = FMUL(q3, q3);
+
+    // error is the cross product between measured and estimated gravity (halved)
+    imufusion_t vx = q1q3 - q0q2;
+    imufusion_t vy = q0q1 + q2q3;
+    imufusion_t vz = q0q0 - FHALF + q3q3;
+    imufusion_t ex = FMUL(a[1], vz) - FMUL(a[2], vy);
+    imufusion_t ey = FMUL(a[2], vx) - FMUL(a[0], vz);
+    imufusion_t ez = FMUL(a[0], vy) - FMUL(a[1], vx);
+
+    if (m) {
+        imufusion_t hx = FMUL(m[0], FONE - 2 * (q2q2 + q3q3)) + 2 * (FMUL(m[1], q1q2 - q0q3) + FMUL(m[2], q1q3 + q0q2));
+        imufusion_t hy = FMUL(m[1], FONE - 2 * (q1q1 + q3q3)) + 2 * (FMUL(m[0], q1q2 + q0q3) + FMUL(m[2], q2q3 - q0q1));
+        imufusion_t bz = FMUL(m[2], FONE - 2 * (q1q1 + q2q2)) + 2 * (FMUL(m[0], q1q3 - q0q2) + FMUL(m[1], q2q3 + q0q1));
+        imufusion_t bx = norm2(hx, hy);
+
+        imufusion_t wx = FMUL(bx, FHALF - q2q2 - q3q3) + FMUL(bz, q1q3 - q0q2);
+        imufusion_t wy = FMUL(bx, q1q2 - q0q3) + FMUL(bz, q0q1 + q2q3);
+        imufusion_t wz = FMUL(bx, q0q2 + q1q3) + FMUL(bz, FHALF - q1q1 - q2q2);
+        ex += FMUL(m[1], wz) - FMUL(m[2], wy);
+        ey += FMUL(m[2], wx) - FMUL(m[0], wz);
+        ez += FMUL(m[0], wy) - FMUL(m[1], wx);
+    }
+
+    if (kiDt2 != 0) {
+        integral[0] += FMUL(kiDt2, ex);
+        integral[1] += FMUL(kiDt2, ey);
+        integral[2] += FMUL(kiDt2, ez);
+        gx += integral[0];
+        gy += integral[1];
+        gz += integral[2];
+    }
+    gx += FMUL(kpDt, ex);
+    gy += FMUL(kpDt, ey);
+    gz += FMUL(kpDt, ez);
+    integrate(gx, gy, gz);
+}
@@ -0,0 +1,113 @@
+// I2Cdev library collection - Gyro/accel/mag orientation fusion header file
+// Based on S. Madgwick (2010) gradient descent and R. Mahony (2008) complementary filters
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _IMUFUSION_H_
+#define _IMUFUSION_H_
+
+#ifdef ARDUINO
+    #if ARDUINO < 100
+        #include "WProgram.h"
+    #else
+        #include "Arduino.h"
+    #endif
+#else
+    #include <stdint.h>
+#endif
+
+#include <math.h>
+#include "helper_3dmath.h"
+
+// Uncomment to run the filters in Q5.26 integer arithmetic, for cores
+// without an FPU. Setters still take float arguments (setup only).
+//#define IMUFUSION_FIXED_POINT
+
+#ifdef IMUFUSION_FIXED_POINT
+    #define IMUFUSION_Q             26      // fraction bits of imufusion_t
+    #define IMUFUSION_GYRO_SHIFT    16      // extra fraction bits of gyroFactor
+    typedef int32_t imufusion_t;
+#else
+    typedef float imufusion_t;
+#endif
+
+#define IMUFUSION_MADGWICK          0
+#define IMUFUSION_MAHONY            1
+
+#define IMUFUSION_DEFAULT_PERIOD    0.01f           // seconds (100 Hz)
+#define IMUFUSION_DEFAULT_GYRO_SCALE 0.000133158f   // rad/s per LSB, +/-250 deg/s full scale
+#define IMUFUSION_DEFAULT_BETA      0.1f
+#define IMUFUSION_DEFAULT_KP        0.5f
+#define IMUFUSION_DEFAULT_KI        0.0f
+
+class IMUFusion {
+    public:
+        IMUFusion(uint8_t algorithm=IMUFUSION_MADGWICK);
+
+        void reset();
+        void setAlgorithm(uint8_t algorithm);
+        uint8_t getAlgorithm();
+
+        void setSamplePeriod(float seconds);
+        void setGyroScale(float radiansPerSecondPerLSB);
+        void setBeta(float beta);
+        void setMahonyGains(float kp, float ki);
+
+        void update(int16_t gx, int16_t gy, int16_t gz, int16_t ax, int16_t ay, int16_t az);
+        void update(int16_t gx, int16_t gy, int16_t gz, int16_t ax, int16_t ay, int16_t az, int16_t mx, int16_t my, int16_t mz);
+        uint16_t updateBatch(const int16_t *gyro, const int16_t *accel, const int16_t *mag, uint16_t count);
+
+        void getQuaternion(Quaternion *q);
+        void getQuaternion(int16_t *data);
+
+    private:
+        uint8_t algorithm;
+        float period, gyroScale, beta, kp, ki;
+
+        imufusion_t q[4];           // w, x, y, z
+        imufusion_t integral[3];    // Mahony integral feedback, in half-step units
+
+        #ifdef IMUFUSION_FIXED_POINT
+            int32_t gyroFactor;     // Q(IMUFUSION_Q + IMUFUSION_GYRO_SHIFT)
+        #else
+            float gyroFactor;       // raw LSB -> radians per half step
+        #endif
+        imufusion_t betaDt, kpDt, kiDt2;
+
+        void recompute();
+        void step(const int16_t *g, const int16_t *a, const int16_t *m);
+        void madgwick(imufusion_t gx, imufusion_t gy, imufusion_t gz, const imufusion_t *a, const imufusion_t *m);
+        void mahony(imufusion_t gx, imufusion_t gy, imufusion_t gz, const imufusion_t *a, const imufusion_t *m);
+        void integrate(imufusion_t gx, imufusion_t gy, imufusion_t gz);
+};
+
+#endif /* _IMUFUSION_H_ */
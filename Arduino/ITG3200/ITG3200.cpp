@@ -37,6 +37,7 @@ THE SOFTWARE.
  */
 ITG3200::ITG3200() {
     devAddr = ITG3200_DEFAULT_ADDRESS;
+    sampleSequence = 0;
 }
 
 /** Specific address constructor.
@@ -47,6 +48,7 @@ ITG3200::ITG3200() {
  */
 ITG3200::ITG3200(uint8_t address) {
     devAddr = address;
+    sampleSequence = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -368,6 +370,26 @@ void ITG3200::getRotation(int16_t* x, int16_t* y, int16_t* z) {
     *y = (((int16_t)buffer[2]) << 8) | buffer[3];
     *z = (((int16_t)buffer[4]) << 8) | buffer[5];
 }
+/** Get the current rotation as a MotionSample.
+ * Same 6-byte burst as getRotation(), decoded straight into the caller's
+ * buffer and stamped with micros() and the driver's sample sequence.
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer
+ * @return Number of samples written (0 or 1)
+ * @see getRotation()
+ * @see MotionSample
+ */
+uint8_t ITG3200::getSamples(MotionSample *samples, uint8_t maxSamples) {
+    if (maxSamples == 0 || I2Cdev::readBytes(devAddr, ITG3200_RA_GYRO_XOUT_H, 6, buffer) != 6) return 0;
+    samples -> timestamp = micros();
+    samples -> sequence = sampleSequence++;
+    samples -> type = MOTION_SAMPLE_GYRO;
+    samples -> scale = ITG3200_SAMPLE_SCALE;
+    samples -> x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    samples -> y = (((int16_t)buffer[2]) << 8) | buffer[3];
+    samples -> z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    return 1;
+}
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
  * @see ITG3200_RA_GYRO_XOUT_H
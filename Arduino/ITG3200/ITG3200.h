@@ -34,11 +34,14 @@ THE SOFTWARE.
 #define _ITG3200_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 #define ITG3200_ADDRESS_AD0_LOW     0x68 // address pin low (GND), default for SparkFun IMU Digital Combo board
 #define ITG3200_ADDRESS_AD0_HIGH    0x69 // address pin high (VCC), default for SparkFun ITG-3200 Breakout board
 #define ITG3200_DEFAULT_ADDRESS     ITG3200_ADDRESS_AD0_LOW
 
+#define ITG3200_SAMPLE_SCALE        (-4) // 14.375 LSB per deg/s, as 2^-4 deg/s per LSB
+
 #define ITG3200_RA_WHO_AM_I         0x00
 #define ITG3200_RA_SMPLRT_DIV       0x15
 #define ITG3200_RA_DLPF_FS          0x16
@@ -157,6 +160,7 @@ class ITG3200 {
         int16_t getRotationX();
         int16_t getRotationY();
         int16_t getRotationZ();
+        uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
 
         // PWR_MGM register
         void reset();
@@ -174,6 +178,7 @@ class ITG3200 {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        uint16_t sampleSequence;
 };
 
 #endif /* _ITG3200_H_ */
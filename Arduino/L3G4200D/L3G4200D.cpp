@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2013-07-31 - initial release
+//     2026-10-19 - add FIFO watermark streaming with timestamp reconstruction
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +38,11 @@ THE SOFTWARE.
  */
 L3G4200D::L3G4200D() {
     devAddr = L3G4200D_DEFAULT_ADDRESS;
+    streamPeriod = 10000;
+    bigEndian = false;
+    streamEnabled = false;
+    sampleScale = L3G4200D_SAMPLE_SCALE_250;
+    sampleSequence = 0;
 }
 
 /** Specific address constructor.
@@ -46,6 +52,11 @@ L3G4200D::L3G4200D() {
  */
 L3G4200D::L3G4200D(uint8_t address) {
     devAddr = address;
+    streamPeriod = 10000;
+    bigEndian = false;
+    streamEnabled = false;
+    sampleScale = L3G4200D_SAMPLE_SCALE_250;
+    sampleSequence = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -62,6 +73,7 @@ void L3G4200D::initialize() {
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG3, 0b00000000);
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG4, 0b00000000);
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG5, 0b00000000);
+	bigEndian = false;
 }
 
 /** Verify the I2C connection.
@@ -579,6 +591,7 @@ bool L3G4200D::getBlockDataUpdateEnabled() {
 void L3G4200D::setEndianMode(bool endianness) {
 	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT, 
 		endianness);
+	bigEndian = endianness;
 }
 
 /** Get the data endian mode
@@ -591,6 +604,7 @@ void L3G4200D::setEndianMode(bool endianness) {
 bool L3G4200D::getEndianMode() {
 	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT,
 		buffer);
+	bigEndian = buffer[0];
 	return buffer[0];
 }
 
@@ -608,10 +622,13 @@ void L3G4200D::setFullScale(uint16_t scale) {
 	
 	if (scale == 250) {
 		writeBits = L3G4200D_FS_250;
+		sampleScale = L3G4200D_SAMPLE_SCALE_250;
 	} else if (scale == 500) {
 		writeBits = L3G4200D_FS_500;
+		sampleScale = L3G4200D_SAMPLE_SCALE_500;
 	} else {
 		writeBits = L3G4200D_FS_2000;
+		sampleScale = L3G4200D_SAMPLE_SCALE_2000;
 	}
 
 	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_FS_BIT, 
@@ -950,12 +967,8 @@ void L3G4200D::getAngularVelocity(int16_t* x, int16_t* y, int16_t* z) {
  * @see L3G4200D_RA_OUT_X_H
  */
 int16_t L3G4200D::getAngularVelocityX() {
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L, 2, buffer);
-	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t)buffer[1]) << 8) | buffer[0];
-	} else {
-		return (((int16_t)buffer[0]) << 8) | buffer[1];
-	}
+	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | L3G4200D_AUTO_INCREMENT, 2, buffer);
+	return decodeAxis(buffer);
 }
 	
 /** Get the angular velocity about the Y-axis
@@ -964,12 +977,8 @@ int16_t L3G4200D::getAngularVelocityX() {
  * @see L3G4200D_RA_OUT_Y_H
  */
 int16_t L3G4200D::getAngularVelocityY() {
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Y_L, 2, buffer);
-	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t)buffer[1]) << 8) | buffer[0];
-	} else {
-		return (((int16_t)buffer[0]) << 8) | buffer[1];
-	}
+	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Y_L | L3G4200D_AUTO_INCREMENT, 2, buffer);
+	return decodeAxis(buffer);
 }
 
 /** Get the angular velocity about the Z-axis
@@ -978,12 +987,8 @@ int16_t L3G4200D::getAngularVelocityY() {
  * @see L3G4200D_RA_OUT_Z_H
  */
 int16_t L3G4200D::getAngularVelocityZ() {
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Z_L, 2, buffer);
-	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t)buffer[1]) << 8) | buffer[0];
-	} else {
-		return (((int16_t)buffer[0]) << 8) | buffer[1];
-	}
+	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Z_L | L3G4200D_AUTO_INCREMENT, 2, buffer);
+	return decodeAxis(buffer);
 }
 
 // FIFO_CTRL register, r/w
@@ -1093,6 +1098,138 @@ uint8_t L3G4200D::getFIFOStoredDataLevel() {
     return buffer[0];
 }
 
+// FIFO streaming
+
+/** Enable the FIFO in stream mode with a watermark interrupt on INT2.
+ * Call this after setOutputDataRate(); the data rate is cached here so
+ * getFIFOAngularVelocity() does not have to read it back for every batch.
+ * The byte order is tracked by setEndianMode() for all reads.
+ * @param watermark Number of stored samples that raise the INT2 watermark
+ * interrupt (1-31)
+ * @see getFIFOAngularVelocity()
+ * @see L3G4200D_RA_FIFO_CTRL
+ * @see L3G4200D_FM_STREAM
+ */
+void L3G4200D::initializeFIFOStream(uint8_t watermark) {
+	streamPeriod = 1000000UL / getOutputDataRate();
+	streamEnabled = true;
+
+	I2Cdev::writeByte(devAddr, L3G4200D_RA_FIFO_CTRL, 
+		(L3G4200D_FM_STREAM << (L3G4200D_FIFO_MODE_BIT - L3G4200D_FIFO_MODE_LENGTH + 1))
+		| (watermark & 0x1F));
+	setFIFOEnabled(true);
+	setINT2FIFOWatermarkInterruptEnabled(true);
+}
+
+/** Drain stored FIFO samples with auto-incrementing burst reads.
+ * FIFO_SRC is read once for the stored level and overrun flag. Samples are
+ * then read starting at OUT_X_L with the auto-increment bit set; in FIFO mode
+ * the address pointer rolls back from OUT_Z_H to OUT_X_L, so each transaction
+ * pops L3G4200D_FIFO_BURST_SAMPLES whole samples.
+ *
+ * Sample times are reconstructed from the output data rate cached by
+ * initializeFIFOStream(): the newest sample is stamped with micros() at the
+ * time FIFO_SRC was read, and each older sample one period earlier.
+ * @param samples Buffer for packed samples as x0, y0, z0, x1, y1, z1, ...
+ * (room for 3 * maxSamples values), oldest first
+ * @param timestamps Buffer for maxSamples micros() timestamps, or 0 to skip
+ * @param maxSamples Maximum number of samples to read
+ * @param overrun Set to true if the FIFO overflowed and samples were lost
+ * (optional)
+ * @return Number of samples stored in the buffer
+ * @see initializeFIFOStream()
+ * @see L3G4200D_RA_FIFO_SRC
+ * @see L3G4200D_AUTO_INCREMENT
+ */
+uint8_t L3G4200D::getFIFOAngularVelocity(int16_t *samples, uint32_t *timestamps, 
+	uint8_t maxSamples, bool *overrun) {
+	uint8_t count = readFIFOLevel(overrun);
+	uint32_t now = micros();
+	if (count > maxSamples) count = maxSamples;
+	uint8_t done = readFIFO(samples, 3, count);
+
+	if (timestamps) {
+		for (uint8_t i = 0; i < done; i++) {
+			timestamps[i] = now - (uint32_t)(count - 1 - i) * streamPeriod;
+		}
+	}
+	return done;
+}
+
+/** Read angular velocity into MotionSamples.
+ * After initializeFIFOStream() this drains the FIFO like
+ * getFIFOAngularVelocity(), decoding straight into the sample array (oldest
+ * first, back-dated one output period apart). Otherwise it reads the current
+ * output registers as one sample. An overrun skips the sequence number ahead
+ * by one so consumers see the gap.
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer
+ * @return Number of samples written
+ * @see getFIFOAngularVelocity()
+ * @see MotionSample
+ */
+uint8_t L3G4200D::getSamples(MotionSample *samples, uint8_t maxSamples) {
+	bool overrun = false;
+	uint8_t count = streamEnabled ? readFIFOLevel(&overrun) : 1;
+	if (count > maxSamples) count = maxSamples;
+	if (overrun) sampleSequence++;
+
+	uint8_t done = readFIFO(&samples -> x, MOTION_SAMPLE_STRIDE, count);
+	uint32_t now = micros();
+	for (uint8_t i = 0; i < done; i++, samples++) {
+		samples -> timestamp = now - (uint32_t)(count - 1 - i) * streamPeriod;
+		samples -> sequence = sampleSequence++;
+		samples -> type = MOTION_SAMPLE_GYRO;
+		samples -> scale = sampleScale;
+	}
+	return done;
+}
+
+/** Read the FIFO_SRC stored level.
+ * @param overrun Set to the overrun flag (optional)
+ * @return Number of stored samples, 0 on bus error
+ */
+uint8_t L3G4200D::readFIFOLevel(bool *overrun) {
+	if (I2Cdev::readByte(devAddr, L3G4200D_RA_FIFO_SRC, buffer) != 1) return 0;
+	bool ovrn = buffer[0] & (1 << L3G4200D_FIFO_OVRN_BIT);
+	if (overrun) *overrun = ovrn;
+	return ovrn ? L3G4200D_FIFO_SIZE : (buffer[0] & 0x1F);
+}
+/** Decode one axis from its two output bytes, lower address first.
+ * With BLE clear (little endian, the default) the lower address holds the
+ * LSB; with BLE set it holds the MSB. Uses the BLE bit cached by
+ * initialize(), setEndianMode() and getEndianMode().
+ * @param data OUT_x_L and OUT_x_H bytes as read
+ * @return Signed axis value
+ */
+int16_t L3G4200D::decodeAxis(const uint8_t *data) {
+	if (bigEndian) return (((int16_t)data[0]) << 8) | data[1];
+	return (((int16_t)data[1]) << 8) | data[0];
+}
+
+/** Pop samples with auto-incrementing bursts of whole samples.
+ * @param xyz Destination of the first sample's X value
+ * @param stride Distance from one sample's X to the next, in int16_t
+ * @param count Number of samples to read
+ * @return Number of samples read before any bus error
+ */
+uint8_t L3G4200D::readFIFO(int16_t *xyz, uint8_t stride, uint8_t count) {
+	uint8_t data[L3G4200D_FIFO_BURST_SAMPLES * 6];
+	uint8_t done = 0;
+	while (done < count) {
+		uint8_t burst = min(count - done, L3G4200D_FIFO_BURST_SAMPLES);
+		if (I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | L3G4200D_AUTO_INCREMENT,
+			burst * 6, data) != burst * 6) break;
+		for (uint8_t i = 0; i < burst * 6; i += 6, xyz += stride) {
+			for (uint8_t j = 0; j < 3; j++) {
+				xyz[j] = decodeAxis(data + i + 2*j);
+			}
+		}
+		done += burst;
+	}
+	return done;
+}
+
 // INT1_CFG register, r/w
 
 /** Set the combination mode for interrupt events
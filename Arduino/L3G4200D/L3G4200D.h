@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2013-07-31 - initial release
+//     2026-10-19 - add FIFO watermark streaming with timestamp reconstruction
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -34,6 +35,7 @@ THE SOFTWARE.
 #define _L3G4200D_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 #define L3G4200D_ADDRESS           0x69
 #define L3G4200D_DEFAULT_ADDRESS   0x69
@@ -132,6 +134,10 @@ THE SOFTWARE.
 #define L3G4200D_FS_500            0b01
 #define L3G4200D_FS_2000           0b10
 
+#define L3G4200D_SAMPLE_SCALE_250  (-7) // 8.75 mdps per LSB, as 2^-7 dps
+#define L3G4200D_SAMPLE_SCALE_500  (-6) // 17.5 mdps per LSB
+#define L3G4200D_SAMPLE_SCALE_2000 (-4) // 70 mdps per LSB
+
 #define L3G4200D_SELF_TEST_NORMAL  0b00
 #define L3G4200D_SELF_TEST_0       0b01
 #define L3G4200D_SELF_TEST_1       0b11
@@ -178,6 +184,19 @@ THE SOFTWARE.
 #define L3G4200D_FIFO_FSS_BIT      4
 #define L3G4200D_FIFO_FSS_LENGTH   5
 
+#define L3G4200D_FIFO_SIZE         32
+#define L3G4200D_AUTO_INCREMENT    0x80 // sub-address MSB enables register auto-increment
+
+// FIFO samples per read transaction; the address pointer rolls back from
+// OUT_Z_H to OUT_X_L in FIFO mode, so any whole number of samples works.
+// Wire is limited to its 32-byte buffer, and I2Cdev::readBytes() returns a
+// signed byte count, so other implementations stop at 126 bytes.
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE
+    #define L3G4200D_FIFO_BURST_SAMPLES 5
+#else
+    #define L3G4200D_FIFO_BURST_SAMPLES 21
+#endif
+
 #define L3G4200D_INT1_AND_OR_BIT   7
 #define L3G4200D_INT1_LIR_BIT      6
 #define L3G4200D_ZHIE_BIT          5
@@ -295,6 +314,7 @@ class L3G4200D {
         int16_t getAngularVelocityX();
 		int16_t getAngularVelocityY();
 		int16_t getAngularVelocityZ();
+		uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
 		
 		// FIFO_CTRL register, r/w
 		void setFIFOMode(uint8_t mode);
@@ -307,6 +327,10 @@ class L3G4200D {
 		bool getFIFOOverrun();
 		bool getFIFOEmpty();
 		uint8_t getFIFOStoredDataLevel();
+
+		// FIFO streaming
+		void initializeFIFOStream(uint8_t watermark);
+		uint8_t getFIFOAngularVelocity(int16_t *samples, uint32_t *timestamps, uint8_t maxSamples, bool *overrun=0);
 		
 		// INT1_CFG register, r/w
 		void setInterruptCombination(bool combination);
@@ -358,6 +382,15 @@ class L3G4200D {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        uint32_t streamPeriod;  // microseconds between FIFO samples
+        bool bigEndian;         // cached CTRL_REG4 BLE bit
+        bool streamEnabled;
+        int8_t sampleScale;
+        uint16_t sampleSequence;
+
+        int16_t decodeAxis(const uint8_t *data);
+        uint8_t readFIFOLevel(bool *overrun);
+        uint8_t readFIFO(int16_t *xyz, uint8_t stride, uint8_t count);
 };
 
 #endif /* _L3G4200D_H_ */
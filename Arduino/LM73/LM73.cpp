@@ -6,20 +6,34 @@
 
 #include "LM73.h"
 
+// worst-case conversion time by resolution, indexed by resolution - 11
+static const uint8_t conversionMs[] = {
+    LM73_CONVERSION_MS_11, LM73_CONVERSION_MS_12, LM73_CONVERSION_MS_13, LM73_CONVERSION_MS_14
+};
+
 LM73::LM73() {
     devAddr = LM73_DEFAULT_ADDRESS;
     devConfig.all = 0x40; // reset state
     devCtrlStat.all = 0x08; // reset state
+    conversionPending = false;
+    conversionTime = 0;
+    conversionStart = 0;
 }
 
 LM73::LM73(uint8_t address) {
     devAddr = address;
     devConfig.all = 0x40; // reset state
     devCtrlStat.all = 0x08; // reset state
+    conversionPending = false;
+    conversionTime = 0;
+    conversionStart = 0;
 }
 
+// nothing to configure, but the register caches are loaded from the device so
+// they are also correct after an MCU-only reset (setResolution() relies on them)
 void LM73::initialize() {
-    // there's nothing to do, really
+    getConfig();
+    getCtrlStat();
 }
 
 bool LM73::testConnection() {
@@ -34,6 +48,11 @@ LM73ConfigReg LM73::getConfig() {
     return devConfig;
 }
 
+void LM73::setConfig(LM73ConfigReg value) {
+    devConfig = value;
+    I2Cdev::writeByte(devAddr, LM73_RA_CONFIG, value.all);
+}
+
 LM73CtrlStatReg LM73::getCtrlStat() {
     I2Cdev::readByte(devAddr, LM73_RA_CTRL_STAT, buffer);
     devCtrlStat.all = buffer[0];
@@ -41,6 +60,7 @@ LM73CtrlStatReg LM73::getCtrlStat() {
 }
 
 void LM73::setCtrlStat(LM73CtrlStatReg value) {
+    devCtrlStat = value;
     I2Cdev::writeByte(devAddr, LM73_RA_CTRL_STAT, value.all);
 }
 
@@ -58,11 +78,69 @@ float LM73::getTemp() {
     return 0.03125f * (float)temp;
 }
 
+// uses the cached control/status register (kept by getCtrlStat/setCtrlStat)
+// instead of reading it back first; only writes if the resolution changes
 void LM73::setResolution(uint8_t resolution) {
-    if(10 < resolution && resolution < 15) {
-        LM73::getCtrlStat();
+    if(10 < resolution && resolution < 15 && devCtrlStat.bit.RES != resolution - 11) {
         devCtrlStat.bit.RES = resolution - 11;
         LM73::setCtrlStat(devCtrlStat);
     }
 }
 
+uint8_t LM73::getResolutionForAccuracy(float accuracy) {
+    uint8_t resolution = 11;
+    float lsb = 0.25f;
+    while (resolution < 14 && lsb > accuracy) {
+        resolution++;
+        lsb *= 0.5f;
+    }
+    return resolution;
+}
+
+// sets the resolution (only if it changed) and starts a conversion with a single
+// config write that both keeps the part in power-down and sets ONE_SHOT. the LM73
+// powers down again by itself when the conversion is done.
+uint8_t LM73::triggerOneShot(float accuracy) {
+    const uint8_t resolution = getResolutionForAccuracy(accuracy);
+    setResolution(resolution);
+
+    LM73ConfigReg config = devConfig;
+    config.bit.PD = 1;
+    config.bit.ONE_SHOT = 1;
+    I2Cdev::writeByte(devAddr, LM73_RA_CONFIG, config.all);
+    config.bit.ONE_SHOT = 0; // self-clearing
+    devConfig = config;
+
+    conversionTime = conversionMs[resolution - 11];
+    conversionStart = millis();
+    conversionPending = true;
+    return conversionTime;
+}
+
+// true once the worst-case conversion time has passed. with pollDAV, the data
+// available flag is also checked before that, at the cost of a register read.
+bool LM73::isConversionReady(bool pollDAV) {
+    if (!conversionPending) return false;
+    if (millis() - conversionStart >= conversionTime) return true;
+    return pollDAV && getCtrlStat().bit.DAV;
+}
+
+bool LM73::isConversionPending() {
+    return conversionPending;
+}
+
+bool LM73::getOneShotTemp(float *temp) {
+    if (!isConversionReady()) return false;
+    conversionPending = false;
+    *temp = getTemp();
+    return true;
+}
+
+// blocking; the MCU can sleep through the delay, which covers the conversion
+float LM73::readTempOneShot(float accuracy) {
+    delay(triggerOneShot(accuracy));
+    while (!isConversionReady());
+    conversionPending = false;
+    return getTemp();
+}
+
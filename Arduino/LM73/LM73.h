@@ -25,6 +25,12 @@
 #define LM73_RA_CTRL_STAT		0x04
 #define LM73_RA_ID			0x07
 
+// worst-case conversion times in ms, by resolution (datasheet table 6.5)
+#define LM73_CONVERSION_MS_11		14 // 0.25 C
+#define LM73_CONVERSION_MS_12		28 // 0.125 C
+#define LM73_CONVERSION_MS_13		56 // 0.0625 C
+#define LM73_CONVERSION_MS_14		112 // 0.03125 C
+
 typedef struct {
     unsigned :2;          // reserved
     unsigned ONE_SHOT:1;  // one shot (write 1 to start a conversion when PD == 1)
@@ -70,12 +76,24 @@ class LM73 {
         uint8_t getResolution(); // returns resolution in bits (including sign bit)
         void setResolution(uint8_t resolution); // enter resolution in bits (including sign bit)
         float getTemp(); // return temperature in C
+
+        // one-shot scheduler: the part stays powered down except during a conversion
+        uint8_t getResolutionForAccuracy(float accuracy); // coarsest resolution with LSB <= accuracy
+        uint8_t triggerOneShot(float accuracy); // returns the conversion time in ms
+        bool isConversionReady(bool pollDAV = false);
+        bool isConversionPending(); // triggered and not yet collected
+        bool getOneShotTemp(float *temp); // false until the triggered conversion is done
+        float readTempOneShot(float accuracy); // trigger, sleep, read
 		
     private:
         uint8_t devAddr;
         uint8_t buffer[1];
         LM73ConfigReg devConfig;
         LM73CtrlStatReg devCtrlStat;
+
+        bool conversionPending;
+        uint8_t conversionTime;
+        uint32_t conversionStart;
 };
 
 #endif
@@ -37,12 +37,30 @@ THE SOFTWARE.
 #include "I2Cdev.h"
 
 MPR121::MPR121(uint8_t address) :
-  m_devAddr(address)
+  m_devAddr(address),
+  m_prevTouchStatus(0),
+  m_touchStatus(0),
+  m_touchThreshold(TOUCH_THRESHOLD),
+  m_releaseThreshold(RELEASE_THRESHOLD),
+  m_debounce(0),
+  m_longPress(0),
+  m_state(0),
+  m_pending(0),
+  m_longSent(0),
+  m_interruptDriven(false),
+  m_irqPending(false),
+  m_queueHead(0),
+  m_queueTail(0),
+  m_droppedEvents(0)
 {
   for (int ch = 0; ch < NUM_CHANNELS; ch++) {
     m_callbackMap[ch][TOUCHED] = 0;
     m_callbackMap[ch][RELEASED] = 0;
   }
+  for (int ch = 0; ch < NUM_ELECTRODES; ch++) {
+    m_filtered[ch] = 0;
+    m_baseline[ch] = 0;
+  }
 }
 
 void MPR121::initialize()
@@ -100,33 +118,10 @@ void MPR121::initialize()
   //   very large electrodes the reverse is true.  One easy method is 
   //   to view the deltas actually seen in a system and set the touch 
   //   at 80% and release at 70% of delta for good performance.
-  I2Cdev::writeByte(m_devAddr, ELE0_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE0_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE1_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE1_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE2_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE2_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE3_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE3_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-
-  // TODO: enable setting these channels to capsense or GPIO
-  // for now they are all capsense
-  I2Cdev::writeByte(m_devAddr, ELE4_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE4_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE5_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE5_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE6_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE6_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE7_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE7_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE8_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE8_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE9_TOUCH_THRESHOLD,    TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE9_RELEASE_THRESHOLD,  RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE10_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE10_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE11_TOUCH_THRESHOLD,   TOUCH_THRESHOLD);
-  I2Cdev::writeByte(m_devAddr, ELE11_RELEASE_THRESHOLD, RELEASE_THRESHOLD);
+  // TODO: enable setting channels 4 - 11 to capsense or GPIO
+  // for now they are all capsense. the values are TOUCH_THRESHOLD and
+  // RELEASE_THRESHOLD unless setThresholds() changed them.
+  writeThresholds();
 
   // Section D
   // Description:
@@ -192,30 +187,185 @@ bool MPR121::getTouchStatus(uint8_t channel) {
 }
 
 uint16_t MPR121::getTouchStatus() {
-  uint16_t statusBuf;
-  uint8_t buf;
-  I2Cdev::readByte(m_devAddr, ELE0_ELE7_TOUCH_STATUS, &buf);
-  statusBuf = buf;
-  I2Cdev::readByte(m_devAddr, ELE8_ELE11_ELEPROX_TOUCH_STATUS, &buf);
-  statusBuf += (buf << 8);
-  return statusBuf;
+  uint8_t buf[2] = { 0, 0 };
+  I2Cdev::readBytes(m_devAddr, ELE0_ELE7_TOUCH_STATUS, 2, buf);
+  return buf[0] | (buf[1] << 8);
+}
+
+bool MPR121::update(bool readBaseline) {
+  uint8_t buf[STATUS_BURST_LENGTH];
+  if (I2Cdev::readBytes(m_devAddr, ELE0_ELE7_TOUCH_STATUS, STATUS_BURST_LENGTH, buf) != STATUS_BURST_LENGTH) {
+    return false;
+  }
+  m_touchStatus = (buf[0] | (buf[1] << 8)) & TOUCH_STATUS_MASK;
+  const uint8_t *data = buf + ELE0_FILTERED_DATA_LSB;
+  for (uint8_t ch = 0; ch < NUM_ELECTRODES; ch++, data += 2) {
+    m_filtered[ch] = data[0] | ((data[1] & 0x03) << 8);
+  }
+  if (readBaseline) {
+    if (I2Cdev::readBytes(m_devAddr, ELE0_BASELINE_VALUE, BASELINE_BURST_LENGTH, m_baseline) != BASELINE_BURST_LENGTH) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint16_t MPR121::getLastTouchStatus() {
+  return m_touchStatus;
+}
+
+uint16_t MPR121::getFilteredData(uint8_t channel) {
+  return m_filtered[channel];
+}
+
+uint16_t MPR121::getBaselineData(uint8_t channel) {
+  return (uint16_t)m_baseline[channel] << 2;
+}
+
+int16_t MPR121::getDelta(uint8_t channel) {
+  return (int16_t)getBaselineData(channel) - (int16_t)m_filtered[channel];
 }
 
 void MPR121::setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr) {
+  if (channel >= NUM_CHANNELS || event >= NUM_EVENTS) return;
   m_callbackMap[channel][event] = callbackPtr;
 }
     
 void MPR121::serviceCallbacks() {
-  for (uint8_t channel = 0; channel < NUM_CHANNELS; channel++) { 
-    bool touchStatus = getTouchStatus(channel);
-    if (touchStatus != m_prevTouchStatus[channel]) {
-      for (uint8_t type = 0; type < NUM_EVENTS; type++) { 
-        const CallbackPtrType cb = touchStatus ? m_callbackMap[channel][TOUCHED] : m_callbackMap[channel][RELEASED]; 
-        if (cb != 0) {
-          cb();           
+  if (!update(false)) return;
+  const uint16_t touchStatus = m_touchStatus;
+  uint16_t changed = (touchStatus ^ m_prevTouchStatus) & ((1 << NUM_CHANNELS) - 1);
+  m_prevTouchStatus = touchStatus;
+  for (uint8_t channel = 0; changed; channel++, changed >>= 1) {
+    if (!(changed & 1)) continue;
+    const CallbackPtrType cb = (touchStatus & (1 << channel)) ? m_callbackMap[channel][TOUCHED] : m_callbackMap[channel][RELEASED];
+    if (cb != 0) {
+      cb();
+    }
+  }
+}
+
+// touch/release thresholds for baseline - filtered data. the same values go to
+// the chip's ELEx threshold registers and poll() uses the chip's comparisons, so
+// the IRQ pin fires exactly when the debounce engine's raw state can change.
+void MPR121::setThresholds(uint8_t touch, uint8_t release) {
+  m_touchThreshold = touch;
+  m_releaseThreshold = release;
+  writeThresholds();
+}
+
+// the threshold registers only accept writes in stop mode, so the electrode
+// configuration is cleared for the burst and restored afterwards
+void MPR121::writeThresholds() {
+  uint8_t config = 0;
+  I2Cdev::readByte(m_devAddr, ELECTRODE_CONFIG, &config);
+  if (config) I2Cdev::writeByte(m_devAddr, ELECTRODE_CONFIG, 0x00);
+  uint8_t thresholds[2 * NUM_CHANNELS];
+  for (uint8_t ch = 0; ch < NUM_CHANNELS; ch++) {
+    thresholds[2 * ch] = m_touchThreshold;
+    thresholds[2 * ch + 1] = m_releaseThreshold;
+  }
+  I2Cdev::writeBytes(m_devAddr, ELE0_TOUCH_THRESHOLD, 2 * NUM_CHANNELS, thresholds);
+  if (config) I2Cdev::writeByte(m_devAddr, ELECTRODE_CONFIG, config);
+}
+
+void MPR121::setDebounce(uint16_t ms) {
+  m_debounce = ms;
+}
+
+void MPR121::setLongPress(uint16_t ms) {
+  m_longPress = ms;
+}
+
+// once called, poll() skips the bus entirely until the next IRQ, unless a
+// debounce or long-press timer is still running
+void MPR121::interrupt() {
+  m_irqPending = true;
+  m_interruptDriven = true;
+}
+
+// returns true if the electrodes were read
+bool MPR121::poll() {
+  const bool timing = m_pending || (m_longPress && (m_state & ~m_longSent));
+  if (m_interruptDriven && !m_irqPending && !timing) return false;
+  // cleared before the read so an IRQ during it is not lost. the status read
+  // is what releases the IRQ line, so after a failed update there is no new
+  // edge to wait for; stay pending and read again on the next call
+  m_irqPending = false;
+  if (!update(true)) {
+    if (m_interruptDriven) m_irqPending = true;
+    return false;
+  }
+
+  const uint32_t now = millis();
+  for (uint8_t ch = 0; ch < NUM_CHANNELS; ch++) {
+    const uint16_t bit = 1 << ch;
+    const int16_t delta = getDelta(ch);
+    const bool touched = m_state & bit;
+    // same comparisons as the chip: touched above the touch threshold, released
+    // below the release threshold
+    const bool raw = touched ? delta >= m_releaseThreshold : delta > m_touchThreshold;
+
+    if (raw != touched) {
+      if (!(m_pending & bit)) {
+        m_pending |= bit;
+        m_changeTime[ch] = (uint16_t)now;
+      }
+      const uint16_t held = (uint16_t)now - m_changeTime[ch];
+      if (held >= m_debounce) {
+        m_pending &= ~bit;
+        m_state ^= bit;
+        if (raw) {
+          m_pressTime[ch] = m_changeTime[ch];
+          m_longSent &= ~bit;
         }
+        pushEvent(ch, raw ? TOUCHED : RELEASED, now - held);
       }
-      m_prevTouchStatus[channel] = touchStatus; 
+    } else {
+      m_pending &= ~bit;
     }
+
+    if (m_longPress && (m_state & bit) && !(m_longSent & bit)) {
+      const uint16_t pressed = (uint16_t)now - m_pressTime[ch];
+      if (pressed >= m_longPress) {
+        m_longSent |= bit;
+        pushEvent(ch, LONG_PRESSED, now - pressed + m_longPress);
+      }
+    }
+  }
+  return true;
+}
+
+bool MPR121::readEvent(Event *event) {
+  const uint8_t tail = m_queueTail;
+  if (tail == m_queueHead) return false;
+  volatile Event *slot = &m_queue[tail & (EVENT_QUEUE_SIZE - 1)];
+  event->timestamp = slot->timestamp;
+  event->channel = slot->channel;
+  event->type = slot->type;
+  m_queueTail = tail + 1; // publish the free slot only after the copy
+  return true;
+}
+
+uint8_t MPR121::getEventCount() {
+  return (uint8_t)(m_queueHead - m_queueTail);
+}
+
+// events that arrived while the queue was full. the newest are dropped, so what
+// is queued is never overwritten under a reader
+uint16_t MPR121::getDroppedEvents() {
+  return m_droppedEvents;
+}
+
+void MPR121::pushEvent(uint8_t channel, uint8_t type, uint32_t timestamp) {
+  const uint8_t head = m_queueHead;
+  if ((uint8_t)(head - m_queueTail) == EVENT_QUEUE_SIZE) {
+    m_droppedEvents++;
+    return;
   }
+  volatile Event *event = &m_queue[head & (EVENT_QUEUE_SIZE - 1)];
+  event->timestamp = timestamp;
+  event->channel = channel;
+  event->type = type;
+  m_queueHead = head + 1; // publish only after the slot is filled
 }
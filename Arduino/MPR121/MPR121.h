@@ -183,17 +183,38 @@ THE SOFTWARE.
 #define TOUCH_THRESHOLD   0x0F
 #define RELEASE_THRESHOLD 0x0A
 #define NUM_CHANNELS      12
+#define NUM_ELECTRODES    13 // 12 channels plus the proximity electrode (ELEPROX)
+#define TOUCH_STATUS_MASK 0x1FFF
+
+// update() reads status, out-of-range and filtered data (0x00 - 0x1D) in one burst,
+// and the baseline values (0x1E - 0x2A) in a second one. together they exceed the
+// 32-byte Wire buffer, which I2Cdev::readBytes() cannot span with auto-increment.
+#define STATUS_BURST_LENGTH   (ELEPROX_FILTERED_DATA_MSB + 1)
+#define BASELINE_BURST_LENGTH (ELEPROX_BASELINE_VALUE - ELE0_BASELINE_VALUE + 1)
+
+#define EVENT_QUEUE_SIZE 16 // power of two
 
 class MPR121
 {
   public:
     enum EventType {
-      TOUCHED    = 0,
-      RELEASED   = 1,
-      NUM_EVENTS = 2
+      TOUCHED      = 0,
+      RELEASED     = 1,
+      NUM_EVENTS   = 2
+    };
+
+    // Event::type values beyond the callback events; queued only, no callback
+    enum {
+      LONG_PRESSED = NUM_EVENTS
     };
   
     typedef void (*CallbackPtrType)(void);
+
+    struct Event {
+      uint32_t timestamp; // millis() when the debounced change began
+      uint8_t channel;
+      uint8_t type;       // TOUCHED, RELEASED or LONG_PRESSED
+    };
     
     // constructor
     // takes a 7-b I2C address to use (0x5A by default, assumes addr pin grounded)
@@ -210,14 +231,61 @@ class MPR121
     // when not given a channel, returns a bitfield of all touch channels.
     uint16_t getTouchStatus();
 
+    // reads touch status and every electrode's filtered data (and optionally baseline)
+    // in one burst, independent of the number of channels. returns false on a bus error.
+    bool update(bool readBaseline = true);
+    // results of the last update(); channel 12 is the proximity electrode
+    uint16_t getLastTouchStatus();
+    uint16_t getFilteredData(uint8_t channel); // 10 bits
+    uint16_t getBaselineData(uint8_t channel); // 10 bits, low 2 bits always 0
+    int16_t getDelta(uint8_t channel);         // baseline - filtered, > 0 when touched
+
     void setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr);
     
+    // update() without baseline, then one callback per channel that changed state
     void serviceCallbacks();
+
+    // event queue, an alternative to callbacks. poll() runs the debounce engine on
+    // filtered data minus baseline and queues TOUCHED/RELEASED/LONG_PRESSED events;
+    // readEvent() drains them from any other loop. one producer and one consumer
+    // may run in different contexts without locking.
+    void setThresholds(uint8_t touch, uint8_t release); // also written to the chip
+    void setDebounce(uint16_t ms);   // a change must hold this long, 0 = immediate
+    void setLongPress(uint16_t ms);  // 0 = no LONG_PRESSED events
+    void interrupt();                // call from the IRQ pin (FALLING) handler
+    bool poll();
+    bool readEvent(Event *event);
+    uint8_t getEventCount();
+    uint16_t getDroppedEvents();
     
   private:
     uint8_t m_devAddr; // contains the I2C address of the device
     CallbackPtrType m_callbackMap[NUM_CHANNELS][NUM_EVENTS];
-    bool m_prevTouchStatus[NUM_CHANNELS];
+    uint16_t m_prevTouchStatus;  // status at the last serviceCallbacks()
+    uint16_t m_touchStatus;      // status at the last update()
+    uint16_t m_filtered[NUM_ELECTRODES];
+    uint8_t m_baseline[NUM_ELECTRODES];
+
+    void pushEvent(uint8_t channel, uint8_t type, uint32_t timestamp);
+    void writeThresholds();
+
+    // debounce engine, one bit per channel
+    uint8_t m_touchThreshold;
+    uint8_t m_releaseThreshold;
+    uint16_t m_debounce;
+    uint16_t m_longPress;
+    uint16_t m_state;      // debounced touch state
+    uint16_t m_pending;    // raw state differs, waiting out the debounce time
+    uint16_t m_longSent;   // LONG_PRESSED already queued for this touch
+    uint16_t m_changeTime[NUM_CHANNELS]; // low 16 bits of millis()
+    uint16_t m_pressTime[NUM_CHANNELS];
+    volatile bool m_interruptDriven;
+    volatile bool m_irqPending;
+
+    volatile Event m_queue[EVENT_QUEUE_SIZE];
+    volatile uint8_t m_queueHead;  // written by poll() only
+    volatile uint8_t m_queueTail;  // written by readEvent() only
+    uint16_t m_droppedEvents;
     
 };
 
@@ -41,6 +41,10 @@ THE SOFTWARE.
  */
 MPU6050::MPU6050() {
     devAddr = MPU6050_DEFAULT_ADDRESS;
+    auxMagType = MPU6050_AUX_MAG_NONE;
+    sampleAccelScale = MPU6050_SAMPLE_SCALE_ACCEL_2;
+    sampleGyroScale = MPU6050_SAMPLE_SCALE_GYRO_250;
+    sampleSequence = 0;
 }
 
 /** Specific address constructor.
@@ -51,6 +55,10 @@ MPU6050::MPU6050() {
  */
 MPU6050::MPU6050(uint8_t address) {
     devAddr = address;
+    auxMagType = MPU6050_AUX_MAG_NONE;
+    sampleAccelScale = MPU6050_SAMPLE_SCALE_ACCEL_2;
+    sampleGyroScale = MPU6050_SAMPLE_SCALE_GYRO_250;
+    sampleSequence = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -75,6 +83,93 @@ bool MPU6050::testConnection() {
     return getDeviceID() == 0x34;
 }
 
+/** Hand a magnetometer on the auxiliary bus over to the internal I2C master.
+ * The magnetometer is first checked and configured through bypass mode, then
+ * Slave 0 is set up to copy its six data bytes into EXT_SENS_DATA_00..05 on
+ * every (delayed) sample, so getMotion9() returns accel, temp, gyro and mag
+ * from one 20-byte burst. For the AK8975, Slave 0 reads HXL..ST2 (the ST2
+ * read releases the data protection latch) and Slave 1 then writes CNTL to
+ * start the next single measurement; for the HMC5883L, Slave 0 reads
+ * DXRA..DYRB while the sensor free-runs in continuous mode.
+ *
+ * Slave access is throttled with I2C_MST_DELAY_CTRL to roughly the
+ * magnetometer's own rate, using the sample rate configured at call time;
+ * call this again after changing setRate() or setDLPFMode(). The MPU6050 must
+ * already be awake (see initialize()).
+ *
+ * @param type MPU6050_AUX_MAG_AK8975 or MPU6050_AUX_MAG_HMC5883L
+ * @param address 7-bit I2C address of the magnetometer on the auxiliary bus
+ * @return True if the magnetometer answered with its ID, false otherwise
+ * @see getMotion9()
+ * @see MPU6050_RA_I2C_SLV0_ADDR
+ * @see MPU6050_RA_EXT_SENS_DATA_00
+ */
+bool MPU6050::initializeAuxMagnetometer(uint8_t type, uint8_t address) {
+    uint16_t magRate;
+    auxMagType = MPU6050_AUX_MAG_NONE;
+
+    // talk to the magnetometer directly while the master is off
+    setI2CMasterModeEnabled(false);
+    setI2CBypassEnabled(true);
+    if (type == MPU6050_AUX_MAG_AK8975) {
+        if (I2Cdev::readByte(address, 0x00, buffer) != 1 || buffer[0] != 0x48) type = MPU6050_AUX_MAG_NONE; // WIA
+        else I2Cdev::writeByte(address, 0x0A, 0x00); // CNTL: power-down
+        magRate = MPU6050_AUX_MAG_AK8975_RATE;
+    } else if (type == MPU6050_AUX_MAG_HMC5883L) {
+        if (I2Cdev::readByte(address, 0x0A, buffer) != 1 || buffer[0] != 'H') type = MPU6050_AUX_MAG_NONE; // ID_A
+        else {
+            I2Cdev::writeByte(address, 0x00, 0x18); // CONFIG_A: 1 average, 75 Hz, normal bias
+            I2Cdev::writeByte(address, 0x01, 0x20); // CONFIG_B: 1.3 Ga (1090 LSB/Ga)
+            I2Cdev::writeByte(address, 0x02, 0x00); // MODE: continuous
+        }
+        magRate = MPU6050_AUX_MAG_HMC5883L_RATE;
+    } else {
+        type = MPU6050_AUX_MAG_NONE;
+    }
+    setI2CBypassEnabled(false);
+    if (type == MPU6050_AUX_MAG_NONE) return false;
+
+    // sample rate = gyro output rate / (1 + SMPLRT_DIV); access slaves every (1 + MST_DLY) samples
+    uint8_t dlpf = getDLPFMode();
+    uint16_t sampleRate = ((dlpf == 0 || dlpf == 7) ? 8000 : 1000) / (1 + (uint16_t)getRate());
+    uint16_t skip = (sampleRate + magRate - 1) / magRate;
+    if (skip > 32) skip = 32;
+
+    setMasterClockSpeed(MPU6050_CLOCK_DIV_400);
+    setWaitForExternalSensorEnabled(true);
+    setExternalShadowDelayEnabled(true);
+    setSlave4MasterDelay(skip - 1);
+
+    setSlaveAddress(0, address | 0x80); // read
+    if (type == MPU6050_AUX_MAG_AK8975) {
+        setSlaveRegister(0, 0x03);      // HXL
+        setSlaveDataLength(0, 7);       // HXL..HZH, ST2
+        setSlaveAddress(1, address);    // write
+        setSlaveRegister(1, 0x0A);      // CNTL
+        setSlaveOutputByte(1, 0x01);    // single measurement
+        setSlaveDataLength(1, 1);
+        setSlaveDelayEnabled(1, skip > 1);
+        setSlaveEnabled(1, true);
+    } else {
+        setSlaveEnabled(1, false);
+        setSlaveRegister(0, 0x03);      // DXRA
+        setSlaveDataLength(0, 6);       // X, Z, Y
+    }
+    setSlaveDelayEnabled(0, skip > 1);
+    setSlaveEnabled(0, true);
+    setI2CMasterModeEnabled(true);
+
+    auxMagType = type;
+    return true;
+}
+/** Get the magnetometer type currently polled by the internal I2C master.
+ * @return MPU6050_AUX_MAG_NONE, MPU6050_AUX_MAG_AK8975 or MPU6050_AUX_MAG_HMC5883L
+ * @see initializeAuxMagnetometer()
+ */
+uint8_t MPU6050::getAuxMagnetometer() {
+    return auxMagType;
+}
+
 // AUX_VDDIO register (InvenSense demo code calls this RA_*G_OFFS_TC)
 
 /** Get the auxiliary I2C supply voltage level.
@@ -251,6 +346,7 @@ uint8_t MPU6050::getFullScaleGyroRange() {
  */
 void MPU6050::setFullScaleGyroRange(uint8_t range) {
     I2Cdev::writeBits(devAddr, MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, range);
+    sampleGyroScale = MPU6050_SAMPLE_SCALE_GYRO_250 + range;
 }
 
 // ACCEL_CONFIG register
@@ -327,6 +423,7 @@ uint8_t MPU6050::getFullScaleAccelRange() {
  */
 void MPU6050::setFullScaleAccelRange(uint8_t range) {
     I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, range);
+    sampleAccelScale = MPU6050_SAMPLE_SCALE_ACCEL_2 + range;
 }
 /** Get the high-pass filter configuration.
  * The DHPF is a filter module in the path leading to motion detectors (Free
@@ -1700,7 +1797,12 @@ bool MPU6050::getIntDataReadyStatus() {
 // ACCEL_*OUT_* registers
 
 /** Get raw 9-axis motion sensor readings (accel/gyro/compass).
- * FUNCTION NOT FULLY IMPLEMENTED YET.
+ * Once initializeAuxMagnetometer() has succeeded, this is a single 20-byte
+ * burst from ACCEL_XOUT_H through EXT_SENS_DATA_05, so all nine axes come
+ * from the same shadow-register snapshot. Magnetometer values are returned in
+ * the slave's native axes and LSB scale (AK8975 little-endian X/Y/Z, HMC5883L
+ * big-endian X/Z/Y, both reordered to X/Y/Z here). Without an auxiliary
+ * magnetometer this behaves like getMotion6() and leaves mx/my/mz untouched.
  * @param ax 16-bit signed integer container for accelerometer X-axis value
  * @param ay 16-bit signed integer container for accelerometer Y-axis value
  * @param az 16-bit signed integer container for accelerometer Z-axis value
@@ -1716,8 +1818,26 @@ bool MPU6050::getIntDataReadyStatus() {
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz) {
-    getMotion6(ax, ay, az, gx, gy, gz);
-    // TODO: magnetometer integration
+    if (auxMagType == MPU6050_AUX_MAG_NONE) {
+        getMotion6(ax, ay, az, gx, gy, gz);
+        return;
+    }
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, MPU6050_MOTION9_LENGTH, buffer);
+    *ax = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *ay = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *az = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *gx = (((int16_t)buffer[8]) << 8) | buffer[9];
+    *gy = (((int16_t)buffer[10]) << 8) | buffer[11];
+    *gz = (((int16_t)buffer[12]) << 8) | buffer[13];
+    if (auxMagType == MPU6050_AUX_MAG_AK8975) {
+        *mx = (((int16_t)buffer[15]) << 8) | buffer[14];
+        *my = (((int16_t)buffer[17]) << 8) | buffer[16];
+        *mz = (((int16_t)buffer[19]) << 8) | buffer[18];
+    } else {
+        *mx = (((int16_t)buffer[14]) << 8) | buffer[15];
+        *mz = (((int16_t)buffer[16]) << 8) | buffer[17];
+        *my = (((int16_t)buffer[18]) << 8) | buffer[19];
+    }
 }
 /** Get raw 6-axis motion sensor readings (accel/gyro).
  * Retrieves all currently available motion sensor values.
@@ -1740,6 +1860,57 @@ void MPU6050::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
     *gy = (((int16_t)buffer[10]) << 8) | buffer[11];
     *gz = (((int16_t)buffer[12]) << 8) | buffer[13];
 }
+/** Read accel, gyro and (if configured) aux magnetometer into MotionSamples.
+ * One burst, as in getMotion6()/getMotion9(), decoded straight into the
+ * caller's buffer: samples[0] is acceleration, samples[1] rotation and, with
+ * an auxiliary magnetometer and room for it, samples[2] the compass. All
+ * samples from one burst share a timestamp and sequence number since they
+ * come from the same shadow-register snapshot.
+ * @param samples Output buffer
+ * @param maxSamples Number of samples that fit in the buffer (at least 2)
+ * @return Number of samples written
+ * @see getMotion9()
+ * @see MotionSample
+ */
+uint8_t MPU6050::getSamples(MotionSample *samples, uint8_t maxSamples) {
+    if (maxSamples < 2) return 0;
+    uint8_t count = (auxMagType != MPU6050_AUX_MAG_NONE && maxSamples >= 3) ? 3 : 2;
+    uint8_t length = count == 3 ? MPU6050_MOTION9_LENGTH : 14;
+    if (I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, length, buffer) != length) return 0;
+
+    uint32_t now = micros();
+    for (uint8_t i = 0; i < count; i++) {
+        samples[i].timestamp = now;
+        samples[i].sequence = sampleSequence;
+    }
+    sampleSequence++;
+
+    samples[0].type = MOTION_SAMPLE_ACCEL;
+    samples[0].scale = sampleAccelScale;
+    samples[0].x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    samples[0].y = (((int16_t)buffer[2]) << 8) | buffer[3];
+    samples[0].z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    samples[1].type = MOTION_SAMPLE_GYRO;
+    samples[1].scale = sampleGyroScale;
+    samples[1].x = (((int16_t)buffer[8]) << 8) | buffer[9];
+    samples[1].y = (((int16_t)buffer[10]) << 8) | buffer[11];
+    samples[1].z = (((int16_t)buffer[12]) << 8) | buffer[13];
+    if (count == 3) {
+        samples[2].type = MOTION_SAMPLE_MAG;
+        if (auxMagType == MPU6050_AUX_MAG_AK8975) {
+            samples[2].scale = -2; // 0.3 uT per LSB
+            samples[2].x = (((int16_t)buffer[15]) << 8) | buffer[14];
+            samples[2].y = (((int16_t)buffer[17]) << 8) | buffer[16];
+            samples[2].z = (((int16_t)buffer[19]) << 8) | buffer[18];
+        } else {
+            samples[2].scale = -3; // 1090 LSB per gauss, as set by initializeAuxMagnetometer()
+            samples[2].x = (((int16_t)buffer[14]) << 8) | buffer[15];
+            samples[2].z = (((int16_t)buffer[16]) << 8) | buffer[17];
+            samples[2].y = (((int16_t)buffer[18]) << 8) | buffer[19];
+        }
+    }
+    return count;
+}
 /** Get 3-axis accelerometer readings.
  * These registers store the most recent accelerometer measurements.
  * Accelerometer measurements are written to these registers at the Sample Rate
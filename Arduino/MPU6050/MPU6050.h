@@ -38,6 +38,7 @@ THE SOFTWARE.
 #define _MPU6050_H_
 
 #include "I2Cdev.h"
+#include "MotionSample.h"
 
 // supporting link:  http://forum.arduino.cc/index.php?&topic=143444.msg1079517#msg1079517
 // also: http://forum.arduino.cc/index.php?&topic=141571.msg1062899#msg1062899s
@@ -406,6 +407,17 @@ THE SOFTWARE.
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
 
+#define MPU6050_AUX_MAG_NONE            0
+#define MPU6050_AUX_MAG_AK8975          1
+#define MPU6050_AUX_MAG_HMC5883L        2
+
+#define MPU6050_AUX_MAG_AK8975_RATE     100 // Hz, keeps slave reads >7.3ms apart
+#define MPU6050_AUX_MAG_HMC5883L_RATE   75  // Hz, HMC5883L max continuous rate
+#define MPU6050_MOTION9_LENGTH          20  // ACCEL_XOUT_H through EXT_SENS_DATA_05
+
+#define MPU6050_SAMPLE_SCALE_ACCEL_2    (-14) // 16384 LSB/g at +/-2g
+#define MPU6050_SAMPLE_SCALE_GYRO_250   (-7)  // 131 LSB per deg/s at +/-250 deg/s, as 2^-7
+
 // note: DMP code memory blocks defined at end of header file
 
 class MPU6050 {
@@ -416,6 +428,10 @@ class MPU6050 {
         void initialize();
         bool testConnection();
 
+        // auxiliary magnetometer (internal I2C master)
+        bool initializeAuxMagnetometer(uint8_t type, uint8_t address);
+        uint8_t getAuxMagnetometer();
+
         // AUX_VDDIO register
         uint8_t getAuxVDDIOLevel();
         void setAuxVDDIOLevel(uint8_t level);
@@ -588,6 +604,7 @@ class MPU6050 {
         // ACCEL_*OUT_* registers
         void getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz);
         void getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz);
+        uint8_t getSamples(MotionSample *samples, uint8_t maxSamples);
         void getAcceleration(int16_t* x, int16_t* y, int16_t* z);
         int16_t getAccelerationX();
         int16_t getAccelerationY();
@@ -891,6 +908,10 @@ class MPU6050 {
         #ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS41
             uint8_t *dmpPacketBuffer;
             uint16_t dmpPacketSize;
+            uint8_t dmpMagAdjustment[3];
+            float dmpHeadingOffset;
+            float dmpHeadingGain;
+            bool dmpHeadingValid;
 
             uint8_t dmpInitialize();
             bool dmpPacketAvailable();
@@ -937,6 +958,9 @@ class MPU6050 {
             uint8_t dmpGetGyro(int16_t *data, const uint8_t* packet=0);
             uint8_t dmpGetGyro(VectorInt16 *v, const uint8_t* packet=0);
             uint8_t dmpGetMag(int16_t *data, const uint8_t* packet=0);
+            uint8_t dmpGetMag(VectorInt16 *v, const uint8_t* packet=0);
+            uint8_t dmpSetHeadingCorrectionGain(float gain);
+            uint8_t dmpGetHeadingCorrectedQuaternion(Quaternion *q, const uint8_t* packet=0);
             uint8_t dmpSetLinearAccelFilterCoefficient(float coef);
             uint8_t dmpGetLinearAccel(int32_t *data, const uint8_t* packet=0);
             uint8_t dmpGetLinearAccel(int16_t *data, const uint8_t* packet=0);
@@ -991,7 +1015,11 @@ class MPU6050 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[14];
+        uint8_t buffer[MPU6050_MOTION9_LENGTH];
+        uint8_t auxMagType;
+        int8_t sampleAccelScale;
+        int8_t sampleGyroScale;
+        uint16_t sampleSequence;
 };
 
 #endif /* _MPU6050_H_ */
@@ -108,6 +108,13 @@ THE SOFTWARE.
 #define MPU6050_DMP_CONFIG_SIZE     232     // dmpConfig[]
 #define MPU6050_DMP_UPDATES_SIZE    140     // dmpUpdates[]
 
+#define MPU6050_DMP_MAG_ADDRESS     0x0E    // AK8975 on the auxiliary I2C bus
+#define MPU6050_DMP_MAG_RA_WIA      0x00
+#define MPU6050_DMP_MAG_RA_CNTL     0x0A
+#define MPU6050_DMP_MAG_RA_ASAX     0x10
+#define MPU6050_DMP_MAG_WIA         0x48
+#define MPU6050_DMP_HEADING_GAIN    0.02f   // per-packet heading correction weight
+
 /* ================================================================================================ *
  | Default MotionApps v4.1 48-byte FIFO packet structure:                                           |
  |                                                                                                  |
@@ -334,6 +341,12 @@ const prog_uchar dmpUpdates[MPU6050_DMP_UPDATES_SIZE] PROGMEM = {
     0x00,   0x60,   0x04,   0x00, 0x40, 0x00, 0x00
 };
 
+/** Load and configure the MotionApps 4.1 DMP firmware and the AK8975.
+ * @return 0 on success, 1 if the main DMP code block failed to verify, 2 if
+ * the DMP configuration block failed to verify, 3 if the DMP packet buffer
+ * could not be allocated (reserved, the buffer is currently static), 4 if no
+ * AK8975 answered on the auxiliary bus
+ */
 uint8_t MPU6050::dmpInitialize() {
     // reset device
     DEBUG_PRINTLN(F("\n\nResetting MPU6050..."));
@@ -370,50 +383,56 @@ uint8_t MPU6050::dmpInitialize() {
 
     // get X/Y/Z gyro offsets
     DEBUG_PRINTLN(F("Reading gyro offset values..."));
-    int8_t xgOffset = getXGyroOffset();
-    int8_t ygOffset = getYGyroOffset();
-    int8_t zgOffset = getZGyroOffset();
+    int8_t xgOffsetTC = getXGyroOffsetTC();
+    int8_t ygOffsetTC = getYGyroOffsetTC();
+    int8_t zgOffsetTC = getZGyroOffsetTC();
     DEBUG_PRINT(F("X gyro offset = "));
-    DEBUG_PRINTLN(xgOffset);
+    DEBUG_PRINTLN(xgOffsetTC);
     DEBUG_PRINT(F("Y gyro offset = "));
-    DEBUG_PRINTLN(ygOffset);
+    DEBUG_PRINTLN(ygOffsetTC);
     DEBUG_PRINT(F("Z gyro offset = "));
-    DEBUG_PRINTLN(zgOffset);
+    DEBUG_PRINTLN(zgOffsetTC);
     
     I2Cdev::readByte(devAddr, MPU6050_RA_USER_CTRL, buffer); // ?
     
     DEBUG_PRINTLN(F("Enabling interrupt latch, clear on any read, AUX bypass enabled"));
     I2Cdev::writeByte(devAddr, MPU6050_RA_INT_PIN_CFG, 0x32);
 
-    // enable MPU AUX I2C bypass mode
+    // enable MPU AUX I2C bypass mode (INT_PIN_CFG write above also sets I2C_BYPASS_EN)
     //DEBUG_PRINTLN(F("Enabling AUX I2C bypass mode..."));
     //setI2CBypassEnabled(true);
 
+    DEBUG_PRINTLN(F("Checking magnetometer device ID..."));
+    I2Cdev::readByte(MPU6050_DMP_MAG_ADDRESS, MPU6050_DMP_MAG_RA_WIA, buffer);
+    if (buffer[0] != MPU6050_DMP_MAG_WIA) {
+        DEBUG_PRINTLN(F("ERROR! AK8975 not found on auxiliary bus."));
+        return 4; // magnetometer missing
+    }
+
     DEBUG_PRINTLN(F("Setting magnetometer mode to power-down..."));
-    //mag -> setMode(0);
-    I2Cdev::writeByte(0x0E, 0x0A, 0x00);
+    I2Cdev::writeByte(MPU6050_DMP_MAG_ADDRESS, MPU6050_DMP_MAG_RA_CNTL, 0x00);
+    delay(1); // AK8975 needs 100us in power-down before any mode change
 
     DEBUG_PRINTLN(F("Setting magnetometer mode to fuse access..."));
-    //mag -> setMode(0x0F);
-    I2Cdev::writeByte(0x0E, 0x0A, 0x0F);
+    I2Cdev::writeByte(MPU6050_DMP_MAG_ADDRESS, MPU6050_DMP_MAG_RA_CNTL, 0x0F);
 
+    // ASA is only readable in fuse ROM mode; keep it for dmpGetMag()
     DEBUG_PRINTLN(F("Reading mag magnetometer factory calibration..."));
-    int8_t asax, asay, asaz;
-    //mag -> getAdjustment(&asax, &asay, &asaz);
-    I2Cdev::readBytes(0x0E, 0x10, 3, buffer);
-    asax = (int8_t)buffer[0];
-    asay = (int8_t)buffer[1];
-    asaz = (int8_t)buffer[2];
+    I2Cdev::readBytes(MPU6050_DMP_MAG_ADDRESS, MPU6050_DMP_MAG_RA_ASAX, 3, dmpMagAdjustment);
     DEBUG_PRINT(F("Adjustment X/Y/Z = "));
-    DEBUG_PRINT(asax);
+    DEBUG_PRINT(dmpMagAdjustment[0]);
     DEBUG_PRINT(F(" / "));
-    DEBUG_PRINT(asay);
+    DEBUG_PRINT(dmpMagAdjustment[1]);
     DEBUG_PRINT(F(" / "));
-    DEBUG_PRINTLN(asaz);
+    DEBUG_PRINTLN(dmpMagAdjustment[2]);
 
     DEBUG_PRINTLN(F("Setting magnetometer mode to power-down..."));
-    //mag -> setMode(0);
-    I2Cdev::writeByte(0x0E, 0x0A, 0x00);
+    I2Cdev::writeByte(MPU6050_DMP_MAG_ADDRESS, MPU6050_DMP_MAG_RA_CNTL, 0x00);
+    delay(1);
+
+    dmpHeadingOffset = 0;
+    dmpHeadingGain = MPU6050_DMP_HEADING_GAIN;
+    dmpHeadingValid = false;
 
     // load DMP code into memory banks
     DEBUG_PRINT(F("Writing DMP code to MPU memory banks ("));
@@ -457,14 +476,9 @@ uint8_t MPU6050::dmpInitialize() {
             setOTPBankValid(false);
 
             DEBUG_PRINTLN(F("Setting X/Y/Z gyro offsets to previous values..."));
-            setXGyroOffset(xgOffset);
-            setYGyroOffset(ygOffset);
-            setZGyroOffset(zgOffset);
-
-            DEBUG_PRINTLN(F("Setting X/Y/Z gyro user offsets to zero..."));
-            setXGyroOffsetUser(0);
-            setYGyroOffsetUser(0);
-            setZGyroOffsetUser(0);
+            setXGyroOffsetTC(xgOffsetTC);
+            setYGyroOffsetTC(ygOffsetTC);
+            setZGyroOffsetTC(zgOffsetTC);
 
             DEBUG_PRINTLN(F("Writing final memory update 1/19 (function unknown)..."));
             uint8_t dmpUpdate[16], j;
@@ -496,10 +510,10 @@ uint8_t MPU6050::dmpInitialize() {
             writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
             DEBUG_PRINTLN(F("Disabling all standby flags..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_PWR_MGMT_2, 0x00);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_PWR_MGMT_2, 0x00);
 
             DEBUG_PRINTLN(F("Setting accelerometer sensitivity to +/- 2g..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_ACCEL_CONFIG, 0x00);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_ACCEL_CONFIG, 0x00);
 
             DEBUG_PRINTLN(F("Setting motion detection threshold to 2..."));
             setMotionDetectionThreshold(2);
@@ -514,40 +528,39 @@ uint8_t MPU6050::dmpInitialize() {
             setZeroMotionDetectionDuration(0);
 
             DEBUG_PRINTLN(F("Setting AK8975 to single measurement mode..."));
-            //mag -> setMode(1);
-            I2Cdev::writeByte(0x0E, 0x0A, 0x01);
+            I2Cdev::writeByte(MPU6050_DMP_MAG_ADDRESS, MPU6050_DMP_MAG_RA_CNTL, 0x01);
 
-            // setup AK8975 (0x0E) as Slave 0 in read mode
+            // setup AK8975 as Slave 0 in read mode (10 bytes from INFO, word-swapped)
             DEBUG_PRINTLN(F("Setting up AK8975 read slave 0..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_ADDR, 0x8E);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_REG,  0x01);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_CTRL, 0xDA);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV0_ADDR, 0x80 | MPU6050_DMP_MAG_ADDRESS);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV0_REG,  0x01);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV0_CTRL, 0xDA);
 
-            // setup AK8975 (0x0E) as Slave 2 in write mode
+            // setup AK8975 as Slave 2 in write mode (re-arm single measurement)
             DEBUG_PRINTLN(F("Setting up AK8975 write slave 2..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_ADDR, 0x0E);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_REG,  0x0A);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_CTRL, 0x81);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_DO,   0x01);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV2_ADDR, MPU6050_DMP_MAG_ADDRESS);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV2_REG,  MPU6050_DMP_MAG_RA_CNTL);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV2_CTRL, 0x81);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV2_DO,   0x01);
 
             // setup I2C timing/delay control
             DEBUG_PRINTLN(F("Setting up slave access delay..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV4_CTRL, 0x18);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_MST_DELAY_CTRL, 0x05);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_SLV4_CTRL, 0x18);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, 0x05);
 
             // enable interrupts
             DEBUG_PRINTLN(F("Enabling default interrupt behavior/no bypass..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_INT_PIN_CFG, 0x00);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_INT_PIN_CFG, 0x00);
 
             // enable I2C master mode and reset DMP/FIFO
             DEBUG_PRINTLN(F("Enabling I2C master mode..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_USER_CTRL, 0x20);
             DEBUG_PRINTLN(F("Resetting FIFO..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x24);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_USER_CTRL, 0x24);
             DEBUG_PRINTLN(F("Rewriting I2C master mode enabled because...I don't know"));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_USER_CTRL, 0x20);
             DEBUG_PRINTLN(F("Enabling and resetting DMP/FIFO..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0xE8);
+            I2Cdev::writeByte(devAddr, MPU6050_RA_USER_CTRL, 0xE8);
 
             DEBUG_PRINTLN(F("Writing final memory update 5/19 (function unknown)..."));
             for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
@@ -756,6 +769,57 @@ uint8_t MPU6050::dmpGetMag(int16_t *data, const uint8_t* packet) {
     data[0] = (packet[28] << 8) + packet[29];
     data[1] = (packet[30] << 8) + packet[31];
     data[2] = (packet[32] << 8) + packet[33];
+
+    // sensitivity adjustment from fuse ROM: Hadj = H * (ASA + 128) / 256
+    for (uint8_t i = 0; i < 3; i++) data[i] = ((int32_t)data[i] * (dmpMagAdjustment[i] + 128)) >> 8;
+    return 0;
+}
+uint8_t MPU6050::dmpGetMag(VectorInt16 *v, const uint8_t* packet) {
+    int16_t data[3];
+    uint8_t status = dmpGetMag(data, packet);
+    v -> x = data[0];
+    v -> y = data[1];
+    v -> z = data[2];
+    return status;
+}
+uint8_t MPU6050::dmpSetHeadingCorrectionGain(float gain) {
+    dmpHeadingGain = gain;
+    dmpHeadingValid = false; // re-seed from the next packet
+    return 0;
+}
+uint8_t MPU6050::dmpGetHeadingCorrectedQuaternion(Quaternion *q, const uint8_t* packet) {
+    // The DMP quaternion is gyro/accel only, so its yaw is referenced to
+    // wherever the sensor pointed at start-up and slowly drifts. Rotate the
+    // (adjusted) magnetometer vector into that frame, low-pass the angle
+    // between its horizontal projection and +X, and spin the quaternion back
+    // about Z by that angle so that +X points at magnetic north.
+    Quaternion q6;
+    int16_t m[3];
+    uint8_t status = dmpGetQuaternion(&q6, packet);
+    if (status > 0) return status;
+    dmpGetMag(m, packet);
+
+    if (m[0] != 0 || m[1] != 0 || m[2] != 0) {
+        // AK8975 axes relative to the accel/gyro body frame: X/Y swapped, Z inverted
+        VectorFloat mag(m[1], m[0], -m[2]);
+        mag.rotate(&q6);
+        float heading = atan2(mag.y, mag.x);
+        if (!dmpHeadingValid) {
+            dmpHeadingOffset = heading;
+            dmpHeadingValid = true;
+        } else {
+            float error = heading - dmpHeadingOffset;
+            if (error > M_PI) error -= 2 * M_PI;
+            else if (error < -M_PI) error += 2 * M_PI;
+            dmpHeadingOffset += dmpHeadingGain * error;
+            if (dmpHeadingOffset > M_PI) dmpHeadingOffset -= 2 * M_PI;
+            else if (dmpHeadingOffset < -M_PI) dmpHeadingOffset += 2 * M_PI;
+        }
+    }
+
+    float half = -0.5f * dmpHeadingOffset;
+    Quaternion qz(cos(half), 0, 0, sin(half));
+    *q = qz.getProduct(q6);
     return 0;
 }
 // uint8_t MPU6050::dmpSetLinearAccelFilterCoefficient(float coef);
@@ -0,0 +1,317 @@
+// I2Cdev library collection - Magnetometer hard/soft-iron calibration
+// Based on the algebraic least-squares ellipsoid fit
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "MagCalibration.h"
+#include <math.h>
+#include <string.h>
+
+// index into a packed lower-triangular matrix, j <= i
+#define MAGCAL_P(i, j) ((i) * ((i) + 1) / 2 + (j))
+
+/** Default constructor.
+ * Starts with an identity correction, no sensitivity adjustment, automatic
+ * output radius and the default sample spacing.
+ */
+MagCalibration::MagCalibration() {
+    asa[0] = asa[1] = asa[2] = 256;
+    radius = 0;
+    setSampleSpacing(MAGCAL_DEFAULT_SPACING);
+    reset();
+}
+
+/** Discard the accumulated fit and restore an identity correction.
+ * Sensitivity adjustment, radius and spacing settings are kept.
+ */
+void MagCalibration::reset() {
+    memset(dtd, 0, sizeof(dtd));
+    memset(dt1, 0, sizeof(dt1));
+    samples = 0;
+    lastX = lastY = lastZ = 0;
+    offset[0] = offset[1] = offset[2] = 0;
+    memset(matrix, 0, sizeof(matrix));
+    matrix[0] = matrix[4] = matrix[8] = 1 << MAGCAL_MATRIX_SHIFT;
+}
+
+/** Set per-axis factory sensitivity adjustment (AK8975 ASA registers).
+ * Each raw axis is scaled by (ASA + 128) / 256, as given in the AK8975
+ * datasheet, before it is fitted or corrected. Leave at 128 (the default
+ * equivalent) for magnetometers without factory adjustment.
+ * @param asaX X-axis ASA register value
+ * @param asaY Y-axis ASA register value
+ * @param asaZ Z-axis ASA register value
+ * @see AK8975::getSensitivityAdjustment()
+ */
+void MagCalibration::setSensitivityAdjustment(uint8_t asaX, uint8_t asaY, uint8_t asaZ) {
+    asa[0] = asaX + 128;
+    asa[1] = asaY + 128;
+    asa[2] = asaZ + 128;
+}
+
+/** Set the magnitude of corrected output vectors.
+ * @param radius Field magnitude in raw counts after correction, or 0 to keep
+ * the volume-equivalent radius of the fitted ellipsoid (the default)
+ */
+void MagCalibration::setFieldRadius(int16_t radius) {
+    this -> radius = radius;
+}
+
+/** Set the minimum distance between samples that are added to the fit.
+ * Samples closer than this to the previously accepted sample are skipped so
+ * that a sensor sitting still does not drown out the rest of the sphere.
+ * @param spacing Minimum distance in raw counts (0 to accept every sample)
+ */
+void MagCalibration::setSampleSpacing(int16_t spacing) {
+    spacing2 = (int32_t)spacing * spacing;
+}
+
+/** Add one raw sample to the running ellipsoid fit.
+ * Fits a x^2 + b y^2 + c z^2 + 2d xy + 2e xz + 2f yz + 2g x + 2h y + 2i z = 1
+ * by accumulating the least-squares normal equations, so memory use is fixed
+ * and each update costs the same regardless of how many samples came before.
+ * @param x Raw X-axis heading
+ * @param y Raw Y-axis heading
+ * @param z Raw Z-axis heading
+ * @return True if the sample was added, false if it was too close to the last
+ * one
+ * @see solve()
+ */
+bool MagCalibration::update(int16_t x, int16_t y, int16_t z) {
+    adjust(&x, &y, &z);
+    if (samples > 0) {
+        int32_t dx = (int32_t)x - lastX;
+        int32_t dy = (int32_t)y - lastY;
+        int32_t dz = (int32_t)z - lastZ;
+        if (dx * dx + dy * dy + dz * dz < spacing2) return false;
+    }
+    lastX = x;
+    lastY = y;
+    lastZ = z;
+
+    float xs = x / MAGCAL_INPUT_SCALE;
+    float ys = y / MAGCAL_INPUT_SCALE;
+    float zs = z / MAGCAL_INPUT_SCALE;
+    float d[MAGCAL_PARAMS] = {
+        xs * xs, ys * ys, zs * zs,
+        2 * xs * ys, 2 * xs * zs, 2 * ys * zs,
+        2 * xs, 2 * ys, 2 * zs };
+
+    float *p = dtd;
+    for (uint8_t i = 0; i < MAGCAL_PARAMS; i++) {
+        dt1[i] += d[i];
+        for (uint8_t j = 0; j <= i; j++) *p++ += d[i] * d[j];
+    }
+    if (samples < 0xFFFF) samples++;
+    return true;
+}
+
+/** Get number of samples accumulated since the last reset().
+ * @return Number of samples in the fit (saturates at 65535)
+ */
+uint16_t MagCalibration::getSampleCount() {
+    return samples;
+}
+
+/** Solve the accumulated fit and update the correction.
+ * The offset is the ellipsoid center; the matrix is the symmetric square
+ * root of the ellipsoid shape, which maps it back onto a sphere. If the
+ * samples do not describe an ellipsoid (too few, or not enough orientations
+ * covered) the previous correction is left untouched.
+ * @return True if a new correction was computed, false otherwise
+ */
+bool MagCalibration::solve() {
+    if (samples < MAGCAL_MIN_SAMPLES) return false;
+
+    // Cholesky factorization of D'D in place, then solve D'D p = D'1
+    float l[MAGCAL_PACKED];
+    float p[MAGCAL_PARAMS];
+    memcpy(l, dtd, sizeof(l));
+    for (uint8_t i = 0; i < MAGCAL_PARAMS; i++) {
+        for (uint8_t j = 0; j <= i; j++) {
+            float sum = l[MAGCAL_P(i, j)];
+            for (uint8_t k = 0; k < j; k++) sum -= l[MAGCAL_P(i, k)] * l[MAGCAL_P(j, k)];
+            if (i == j) {
+                if (sum <= 1e-9f) return false;
+                l[MAGCAL_P(i, i)] = sqrt(sum);
+            } else {
+                l[MAGCAL_P(i, j)] = sum / l[MAGCAL_P(j, j)];
+            }
+        }
+    }
+    for (uint8_t i = 0; i < MAGCAL_PARAMS; i++) {
+        float sum = dt1[i];
+        for (uint8_t k = 0; k < i; k++) sum -= l[MAGCAL_P(i, k)] * p[k];
+        p[i] = sum / l[MAGCAL_P(i, i)];
+    }
+    for (int8_t i = MAGCAL_PARAMS - 1; i >= 0; i--) {
+        float sum = p[i];
+        for (uint8_t k = i + 1; k < MAGCAL_PARAMS; k++) sum -= l[MAGCAL_P(k, i)] * p[k];
+        p[i] = sum / l[MAGCAL_P(i, i)];
+    }
+
+    // shape matrix and center, c = -M^-1 [g h i]
+    float m[3][3] = { { p[0], p[3], p[4] }, { p[3], p[1], p[5] }, { p[4], p[5], p[2] } };
+    float inv[3][3];
+    inv[0][0] = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    inv[0][1] = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+    inv[0][2] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+    inv[1][0] = inv[0][1];
+    inv[1][1] = m[0][0] * m[2][2] - m[0][2] * m[2][0];
+    inv[1][2] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+    inv[2][0] = inv[0][2];
+    inv[2][1] = inv[1][2];
+    inv[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+    float det = m[0][0] * inv[0][0] + m[0][1] * inv[1][0] + m[0][2] * inv[2][0];
+    if (det <= 0) return false;
+    float c[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        c[i] = -(inv[i][0] * p[6] + inv[i][1] * p[7] + inv[i][2] * p[8]) / det;
+    }
+
+    // (v - c)' M (v - c) = 1 + c' M c, normalize so the right side is 1
+    float k = 1;
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) k += c[i] * m[i][j] * c[j];
+    }
+    if (k <= 0) return false;
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) m[i][j] /= k;
+    }
+
+    // eigen-decomposition by cyclic Jacobi rotations, M = V diag(m) V'
+    float v[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+    for (uint8_t sweep = 0; sweep < 16; sweep++) {
+        if (fabs(m[0][1]) + fabs(m[0][2]) + fabs(m[1][2]) < 1e-9f) break;
+        for (uint8_t pq = 0; pq < 3; pq++) {
+            uint8_t a = pq == 2 ? 1 : 0;
+            uint8_t b = pq == 0 ? 1 : 2;
+            if (fabs(m[a][b]) < 1e-12f) continue;
+            float theta = (m[b][b] - m[a][a]) / (2 * m[a][b]);
+            float t = 1 / (fabs(theta) + sqrt(theta * theta + 1));
+            if (theta < 0) t = -t;
+            float cs = 1 / sqrt(t * t + 1);
+            float sn = t * cs;
+            for (uint8_t r = 0; r < 3; r++) {
+                float ra = m[r][a], rb = m[r][b];
+                m[r][a] = cs * ra - sn * rb;
+                m[r][b] = sn * ra + cs * rb;
+            }
+            for (uint8_t r = 0; r < 3; r++) {
+                float ar = m[a][r], br = m[b][r];
+                m[a][r] = cs * ar - sn * br;
+                m[b][r] = sn * ar + cs * br;
+            }
+            for (uint8_t r = 0; r < 3; r++) {
+                float ra = v[r][a], rb = v[r][b];
+                v[r][a] = cs * ra - sn * rb;
+                v[r][b] = sn * ra + cs * rb;
+            }
+        }
+    }
+    if (m[0][0] <= 0 || m[1][1] <= 0 || m[2][2] <= 0) return false;
+
+    // W = V diag(sqrt(eigenvalue) * R) V', in normalized units; since input and
+    // output share MAGCAL_INPUT_SCALE it applies to raw counts unchanged
+    float r = radius > 0 ? radius / MAGCAL_INPUT_SCALE : pow(m[0][0] * m[1][1] * m[2][2], -1.0f / 6);
+    float e[3] = { sqrt(m[0][0]) * r, sqrt(m[1][1]) * r, sqrt(m[2][2]) * r };
+    int16_t newMatrix[9];
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            float w = v[i][0] * e[0] * v[j][0] + v[i][1] * e[1] * v[j][1] + v[i][2] * e[2] * v[j][2];
+            w *= (1 << MAGCAL_MATRIX_SHIFT);
+            if (w >= 32767 || w <= -32768) return false;
+            newMatrix[i * 3 + j] = (int16_t)(w < 0 ? w - 0.5f : w + 0.5f);
+        }
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+        float o = c[i] * MAGCAL_INPUT_SCALE;
+        if (o >= 32767 || o <= -32768) return false;
+        offset[i] = (int16_t)(o < 0 ? o - 0.5f : o + 0.5f);
+    }
+    memcpy(matrix, newMatrix, sizeof(matrix));
+    return true;
+}
+
+/** Apply sensitivity adjustment, offset and matrix correction in place.
+ * Integer-only: one 8-bit scale per axis and a 3x3 Q2.13 multiply.
+ * @param x X-axis heading, raw in, corrected out
+ * @param y Y-axis heading, raw in, corrected out
+ * @param z Z-axis heading, raw in, corrected out
+ */
+void MagCalibration::apply(int16_t *x, int16_t *y, int16_t *z) {
+    adjust(x, y, z);
+    int32_t d[3] = { (int32_t)*x - offset[0], (int32_t)*y - offset[1], (int32_t)*z - offset[2] };
+    int16_t *out[3] = { x, y, z };
+    for (uint8_t i = 0; i < 3; i++) {
+        // keep the three products inside 32 bits
+        if (d[i] > 16383) d[i] = 16383;
+        else if (d[i] < -16383) d[i] = -16383;
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+        const int16_t *row = matrix + i * 3;
+        int32_t v = ((int32_t)row[0] * d[0] + (int32_t)row[1] * d[1] + (int32_t)row[2] * d[2]
+                    + (1L << (MAGCAL_MATRIX_SHIFT - 1))) >> MAGCAL_MATRIX_SHIFT;
+        if (v > 32767) v = 32767;
+        else if (v < -32768) v = -32768;
+        *out[i] = v;
+    }
+}
+
+/** Get the current correction, e.g. to store it and skip calibration later.
+ * @param offset Buffer for 3 offset values in (adjusted) raw counts
+ * @param matrix Buffer for 9 row-major Q2.13 matrix values
+ * @see setCorrection()
+ */
+void MagCalibration::getCorrection(int16_t *offset, int16_t *matrix) {
+    memcpy(offset, this -> offset, sizeof(this -> offset));
+    memcpy(matrix, this -> matrix, sizeof(this -> matrix));
+}
+
+/** Load a previously computed correction.
+ * @param offset 3 offset values in (adjusted) raw counts
+ * @param matrix 9 row-major Q2.13 matrix values
+ * @see getCorrection()
+ */
+void MagCalibration::setCorrection(const int16_t *offset, const int16_t *matrix) {
+    memcpy(this -> offset, offset, sizeof(this -> offset));
+    memcpy(this -> matrix, matrix, sizeof(this -> matrix));
+}
+
+/** Scale raw values by the factory sensitivity adjustment.
+ * @see setSensitivityAdjustment()
+ */
+void MagCalibration::adjust(int16_t *x, int16_t *y, int16_t *z) {
+    if (asa[0] != 256) *x = ((int32_t)*x * asa[0]) >> 8;
+    if (asa[1] != 256) *y = ((int32_t)*y * asa[1]) >> 8;
+    if (asa[2] != 256) *z = ((int32_t)*z * asa[2]) >> 8;
+}
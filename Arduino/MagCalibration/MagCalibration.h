@@ -0,0 +1,91 @@
+// I2Cdev library collection - Magnetometer hard/soft-iron calibration header file
+// Based on the algebraic least-squares ellipsoid fit
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MAGCALIBRATION_H_
+#define _MAGCALIBRATION_H_
+
+#ifdef ARDUINO
+    #if ARDUINO < 100
+        #include "WProgram.h"
+    #else
+        #include "Arduino.h"
+    #endif
+#else
+    #include <stdint.h>
+#endif
+
+#define MAGCAL_PARAMS               9       // a, b, c, d, e, f, g, h, i (see update())
+#define MAGCAL_PACKED               45      // MAGCAL_PARAMS * (MAGCAL_PARAMS + 1) / 2
+#define MAGCAL_INPUT_SCALE          2048.0f // raw counts per normalized unit inside the fit
+#define MAGCAL_MATRIX_SHIFT         13      // correction matrix is Q2.13 (range +/-4)
+#define MAGCAL_DEFAULT_SPACING      16      // minimum raw distance between fitted samples
+#define MAGCAL_MIN_SAMPLES          32
+
+class MagCalibration {
+    public:
+        MagCalibration();
+
+        void reset();
+        void setSensitivityAdjustment(uint8_t asaX, uint8_t asaY, uint8_t asaZ);
+        void setFieldRadius(int16_t radius);
+        void setSampleSpacing(int16_t spacing);
+
+        // fit
+        bool update(int16_t x, int16_t y, int16_t z);
+        uint16_t getSampleCount();
+        bool solve();
+
+        // correction
+        void apply(int16_t *x, int16_t *y, int16_t *z);
+        void getCorrection(int16_t *offset, int16_t *matrix);
+        void setCorrection(const int16_t *offset, const int16_t *matrix);
+
+    private:
+        // running sums of the normal equations D'D and D'1, D'D packed lower-triangular
+        float dtd[MAGCAL_PACKED];
+        float dt1[MAGCAL_PARAMS];
+        uint16_t samples;
+
+        int16_t lastX, lastY, lastZ;
+        int32_t spacing2;
+        int16_t radius;
+
+        uint16_t asa[3];        // (ASA + 128), applied as raw * asa / 256
+        int16_t offset[3];
+        int16_t matrix[9];      // row-major, Q2.13
+
+        void adjust(int16_t *x, int16_t *y, int16_t *z);
+};
+
+#endif /* _MAGCALIBRATION_H_ */
@@ -0,0 +1,116 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for SSD1308Surface class
+// 10/19/2026
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Times rendering of a full 128x64 sensor dashboard into an SSD1308Surface,
+// with no I2C traffic in the measured loop, so the result is the CPU cost of
+// drawing alone. The last frame is then sent to the display once.
+
+#include <Wire.h>
+#include "I2Cdev.h"
+#include "SSD1308.h"
+
+#define BENCH_FRAMES 100
+
+SSD1308 oled;
+
+// 16x16 page-packed thermometer icon
+const uint8_t icon[32] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF1, 0xF1, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x4F, 0x4F, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+int16_t history[32];
+
+void formatValue(char *out, const char *label, int16_t value) {
+    // label is 3 characters, value right-aligned in 5
+    uint8_t i = 0;
+    while (*label) out[i++] = *label++;
+    bool negative = value < 0;
+    uint16_t v = negative ? -value : value;
+    for (int8_t p = 7; p >= 3; p--) {
+        out[p] = (p == 7 || v) ? '0' + v % 10 : ' ';
+        v /= 10;
+    }
+    if (negative) out[3] = '-';
+    out[8] = 0;
+}
+
+void renderDashboard(SSD1308Surface *s, uint16_t frame) {
+    char line[9];
+    s -> clear();
+    s -> drawRect(0, 0, 128, 64, SSD1308_WHITE);
+    s -> fillRect(1, 1, 126, 10, SSD1308_WHITE);
+    s -> drawText(4, 2, "SENSORS", SSD1308_BLACK);
+    s -> drawBitmap_P(108, 12, icon, 16, 16, SSD1308_WHITE);
+
+    formatValue(line, "TMP", 215 + (frame & 7));
+    s -> drawText(3, 13, line, SSD1308_WHITE);
+    formatValue(line, "HUM", 48 - (frame & 3));
+    s -> drawText(3, 22, line, SSD1308_WHITE);
+    formatValue(line, "PRS", 10132 + (frame & 15));
+    s -> drawText(3, 31, line, SSD1308_WHITE);
+
+    // bar graphs at arbitrary (non page-aligned) rows
+    s -> drawRect(70, 31, 54, 6, SSD1308_WHITE);
+    s -> fillRect(72, 33, (frame * 3) % 50, 2, SSD1308_WHITE);
+
+    // sparkline of the last 32 readings
+    for (uint8_t i = 1; i < 32; i++) {
+        s -> drawLine(2 + (i - 1) * 4, 60 - history[(frame + i - 1) & 31],
+                      2 + i * 4, 60 - history[(frame + i) & 31], SSD1308_WHITE);
+    }
+    s -> drawHLine(1, 61, 126, SSD1308_INVERT);
+}
+
+void setup() {
+    Wire.begin();
+    Serial.begin(38400);
+
+    for (uint8_t i = 0; i < 32; i++) history[i] = (i * 7) % 19;
+
+    SSD1308Surface *surface = oled.getSurface();
+    uint32_t start = micros();
+    for (uint16_t frame = 0; frame < BENCH_FRAMES; frame++) {
+        renderDashboard(surface, frame);
+    }
+    uint32_t elapsed = micros() - start;
+
+    Serial.print("dashboard render: ");
+    Serial.print(elapsed / BENCH_FRAMES);
+    Serial.println(" us/frame");
+
+    oled.initialize();
+    renderDashboard(surface, BENCH_FRAMES);
+    oled.flush();
+}
+
+void loop() {
+}
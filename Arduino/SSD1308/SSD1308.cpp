@@ -34,14 +34,15 @@ THE SOFTWARE.
 
 #include "SSD1308.h"
 #include "I2Cdev.h"
-
-//#ifdef SSD1308_USE_FONT
-#include "fixedWidthFont.h"
-//#endif
+#include <string.h>
 
 SSD1308::SSD1308(uint8_t address) :
-  m_devAddr(address)
+  m_devAddr(address),
+  m_surface(m_frame, COLUMNS, ROWS)
 {
+  m_surface.setDirtyTracking(m_dirtyStart, m_dirtyEnd);
+  memset(m_frame, 0, FRAME_SIZE);
+  invalidate();
 }
 
 void SSD1308::initialize() 
@@ -53,74 +54,161 @@ void SSD1308::initialize()
 void SSD1308::clearDisplay()
 {
   setDisplayOff();
-  setPageAddress(0, 7);     // all pages
-  setColumnAddress(0, 127); // all columns
-  for (uint8_t page = 0; page < 8; page++)
-  {
-    for (uint8_t col = 0; col < 128; col++)
-    {
-      sendData(0x0);
-    }
-  }
+  clearFrame();
+  invalidate();
+  flush();
   setDisplayOn();
 }
 
 void SSD1308::fillDisplay()
 {
-  setPageAddress(0, MAX_PAGE);      // all pages
-  setColumnAddress(0, MAX_COL); // all columns
-
   uint8_t b = 0;
-  for (uint8_t page = 0; page < PAGES; page++)
+  for (uint16_t i = 0; i < FRAME_SIZE; i++)
   {
-    for (uint8_t col = 0; col < COLUMNS; col++)
-    {
-      sendData(b++);
-    }
+    m_frame[i] = b++;
   }
+  invalidate();
+  flush();
 }
 
-void SSD1308::writeChar(char chr)
+void SSD1308::writeString(uint8_t row, uint8_t col, uint16_t len, const char * text)
 {
-//#ifdef SSD1308_USE_FONT
-  const uint8_t char_index = chr - 0x20;
-  for (uint8_t i = 0; i < 8; i++) {
-     const uint8_t b = pgm_read_byte( &fontData[char_index][i] );
-     sendData( b ); 
+  drawString(row, col, len, text);
+  flush();
+}
+
+uint8_t* SSD1308::getFrameBuffer()
+{
+  return m_frame;
+}
+
+SSD1308Surface* SSD1308::getSurface()
+{
+  return &m_surface;
+}
+
+// blank the frame buffer; the display follows on the next flush()
+void SSD1308::clearFrame()
+{
+  memset(m_frame, 0, FRAME_SIZE);
+  memset(m_dirtyStart, 0, PAGES);
+  memset(m_dirtyEnd, MAX_COL, PAGES);
+}
+
+// same layout and wrapping as writeString(), but only into the frame buffer
+void SSD1308::drawString(uint8_t row, uint8_t col, uint16_t len, const char * text)
+{
+  uint16_t cell = (row % PAGES) * CHARS + (col % CHARS);
+  for (uint16_t index = 0; index < len; index++)
+  {
+    m_surface.drawChar((cell % CHARS) * FONT_WIDTH, (cell / CHARS) * 8, text[index], SSD1308_WHITE, true);
+    if (++cell == PAGES * CHARS) cell = 0;
   }
-//#endif
 }
 
-void SSD1308::writeString(uint8_t row, uint8_t col, uint16_t len, const char * text)
+// record that columns start..end of a page were changed through getFrameBuffer()
+void SSD1308::markDirty(uint8_t page, uint8_t start, uint8_t end)
+{
+  if (start < m_dirtyStart[page]) m_dirtyStart[page] = start;
+  if (end > m_dirtyEnd[page]) m_dirtyEnd[page] = end;
+}
+
+void SSD1308::invalidate()
 {
-  uint16_t index = 0;
-  setPageAddress(row, MAX_PAGE);
-  const uint8_t col_addr = FONT_WIDTH*col;
-  setColumnAddress(col_addr, MAX_COL);
+  memset(m_dirtyStart, 0, PAGES);
+  memset(m_dirtyEnd, MAX_COL, PAGES);
+#ifdef SSD1308_USE_SHADOW
+  m_shadowValid = false;
+#endif
+}
+
+// send each page's changed column span with one address setup and as few
+// data writes as the Wire buffer allows. with the shadow, only the runs within
+// the span that differ from display RAM are sent, runs separated by up to
+// SSD1308_DIFF_GAP unchanged columns going out as one. columns whose data
+// write failed stay dirty and go out again on the next flush().
+void SSD1308::flush()
+{
+  bool complete = true;
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    const uint8_t start = m_dirtyStart[page];
+    const uint8_t end = m_dirtyEnd[page];
+    if (start > end) continue;
+    m_dirtyStart[page] = COLUMNS;
+    m_dirtyEnd[page] = 0;
 
-  while ((col+index) < CHARS && (index < len)) {
-     // write first line, starting at given position
-     writeChar(text[index++]);
+#ifdef SSD1308_USE_SHADOW
+    if (m_shadowValid)
+    {
+      const uint8_t *frame = &m_frame[page * COLUMNS];
+      const uint8_t *shadow = &m_shadow[page * COLUMNS];
+      bool addressed = false;
+      uint8_t col = start;
+      while (col <= end)
+      {
+        if (frame[col] == shadow[col])
+        {
+          col++;
+          continue;
+        }
+        uint8_t runEnd = col;
+        uint8_t next = col + 1;
+        while (next <= end && next - runEnd <= SSD1308_DIFF_GAP)
+        {
+          if (frame[next] != shadow[next]) runEnd = next;
+          next++;
+        }
+        if (!addressed)
+        {
+          setPageAddress(page, page);
+          addressed = true;
+        }
+        if (!sendColumns(page, col, runEnd)) complete = false;
+        col = next;
+      }
+      continue;
+    }
+#endif
+    if (!sendFrame(page, start, end)) complete = false;
   }
+#ifdef SSD1308_USE_SHADOW
+  // an invalid shadow implies the whole frame was dirty; if part of that
+  // full send failed, the parts of the shadow never written are still unknown
+  if (complete) m_shadowValid = true;
+  else if (!m_shadowValid) invalidate();
+#endif
+}
+
+bool SSD1308::sendFrame(uint8_t page, uint8_t start, uint8_t end)
+{
+  setPageAddress(page, page);
+  return sendColumns(page, start, end);
+}
 
-  // write remaining lines
-  // write until the end of memory
-  // then wrap around again from the top.
-  if (index + 1 < len) {
-    setPageAddress(row + 1, MAX_PAGE);
-    setColumnAddress(0, MAX_COL);
-    bool wrapEntireScreen = false;
-    while (index + 1 < len) {
-       writeChar(text[index++]);
-       // if we've written the last character space on the screen, 
-       // reset the page and column address so that it wraps around from the top again
-       if (!wrapEntireScreen && (row*CHARS + col + index) > 127) {
-         setPageAddress(0, MAX_PAGE);
-         setColumnAddress(0, MAX_COL);
-         wrapEntireScreen = true;
-       }
+// stream columns start..end of a page already selected with setPageAddress().
+// the shadow only takes each burst once it was written; on a failed write the
+// unsent columns are marked dirty again and false is returned.
+bool SSD1308::sendColumns(uint8_t page, uint8_t start, uint8_t end)
+{
+  setColumnAddress(start, end);
+  uint8_t *data = &m_frame[page * COLUMNS + start];
+  uint8_t col = start;
+  while (col <= end)
+  {
+    const uint8_t burst = end - col + 1 < SSD1308_MAX_BURST ? end - col + 1 : SSD1308_MAX_BURST;
+    if (!I2Cdev::writeBytes(m_devAddr, DATA_MODE, burst, data))
+    {
+      markDirty(page, col, end);
+      return false;
     }
+#ifdef SSD1308_USE_SHADOW
+    memcpy(&m_shadow[page * COLUMNS + col], data, burst);
+#endif
+    data += burst;
+    col += burst;
   }
+  return true;
 }
 
 void SSD1308::sendCommand(uint8_t command)
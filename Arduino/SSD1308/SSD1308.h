@@ -36,6 +36,7 @@ THE SOFTWARE.
 #define _SSD1308_h_
 
 #include <inttypes.h>
+#include "SSD1308Surface.h"
 
 // this is the 7-bit I2C address
 // which wone is used is determined by the D/C# pin.
@@ -54,6 +55,33 @@ THE SOFTWARE.
 #define CHARS (COLUMNS / FONT_WIDTH)
 #define MAX_PAGE (PAGES - 1)
 #define MAX_COL (COLUMNS - 1)
+#define FRAME_SIZE (PAGES * COLUMNS)
+
+// longest data write that fits the Wire buffer (32) after the control byte
+#define SSD1308_MAX_BURST 31
+
+// keep a shadow copy of the display RAM so flush() only sends bytes that differ
+// from what the controller already shows. costs another FRAME_SIZE bytes of RAM,
+// too much next to the frame buffer on 2KB AVRs (Uno, Leonardo), so there it is
+// off unless the part has at least 4KB (e.g. Mega 2560, 1284P). define
+// SSD1308_USE_SHADOW or SSD1308_NO_SHADOW to force either way; the class layout
+// changes, so the define has to reach every file of the build (compiler flags),
+// not just the sketch.
+#if !defined(SSD1308_USE_SHADOW) && !defined(SSD1308_NO_SHADOW)
+  #ifdef __AVR__
+    #include <avr/io.h>
+    #if RAMEND >= 0x10FF
+      #define SSD1308_USE_SHADOW
+    #endif
+  #else
+    #define SSD1308_USE_SHADOW
+  #endif
+#endif
+
+// unchanged columns between two changed runs are resent rather than starting a
+// new run when that is cheaper than the column address command plus the extra
+// data transaction (address, control, 3 command bytes; address, control)
+#define SSD1308_DIFF_GAP 7
 
 #define HORIZONTAL_ADDRESSING_MODE 0x00
 #define VERTICAL_ADDRESSING_MODE   0x01
@@ -133,6 +161,17 @@ class SSD1308
     // x, y is position (x is row (i.e., page), y is character (0-15), starting at top-left)
     // text will wrap around until it is done.
     void writeString(uint8_t row, uint8_t col, uint16_t len, const char* txt);
+
+    // in-RAM frame buffer, one byte per column per page (bit 0 is the top row of the page).
+    // the draw/mark functions only touch RAM; flush() sends what changed.
+    uint8_t* getFrameBuffer();
+    SSD1308Surface* getSurface(); // pixel drawing into the frame buffer, marks dirty spans
+    void clearFrame();
+    void drawString(uint8_t row, uint8_t col, uint16_t len, const char* txt);
+    void markDirty(uint8_t page, uint8_t start, uint8_t end);
+    void flush();
+    // resend the whole frame on the next flush(), e.g. after writing display RAM with sendData()
+    void invalidate();
     
     //void setXY(uint8_t, uint8_t y);
 
@@ -236,9 +275,19 @@ class SSD1308
     void sendCommand(uint8_t command);
     void sendCommands(uint8_t len, uint8_t* buf);
 
-    void writeChar(char chr);
+    bool sendFrame(uint8_t page, uint8_t start, uint8_t end);
+    bool sendColumns(uint8_t page, uint8_t start, uint8_t end);
     
     uint8_t m_devAddr; // contains the I2C address of the device
+
+    uint8_t m_frame[FRAME_SIZE];   // page-major: m_frame[page * COLUMNS + col]
+    uint8_t m_dirtyStart[PAGES];   // first changed column per page, COLUMNS if clean
+    uint8_t m_dirtyEnd[PAGES];     // last changed column per page
+    SSD1308Surface m_surface;
+#ifdef SSD1308_USE_SHADOW
+    uint8_t m_shadow[FRAME_SIZE];  // what the controller's GDDRAM holds
+    bool m_shadowValid;
+#endif
 };
 
 #endif
@@ -0,0 +1,287 @@
+// I2Cdev library collection - SSD1308 1-bpp drawing surface
+// Based on Solomon Systech SSD1308 datasheet, rev. 1, 10/2008 (GDDRAM layout)
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "SSD1308Surface.h"
+#include <string.h>
+
+#include "fixedWidthFont.h"
+
+#define GLYPH_WIDTH 8
+#define GLYPH_COUNT (sizeof(fontData) / GLYPH_WIDTH)
+
+SSD1308Surface::SSD1308Surface(uint8_t* buffer, uint8_t width, uint8_t height) :
+  m_buffer(buffer),
+  m_width(width),
+  m_height(height),
+  m_pages((height + 7) >> 3),
+  m_dirtyStart(0),
+  m_dirtyEnd(0)
+{
+}
+
+void SSD1308Surface::setDirtyTracking(uint8_t* start, uint8_t* end)
+{
+  m_dirtyStart = start;
+  m_dirtyEnd = end;
+}
+
+uint8_t* SSD1308Surface::getBuffer()
+{
+  return m_buffer;
+}
+
+uint8_t SSD1308Surface::getWidth()
+{
+  return m_width;
+}
+
+uint8_t SSD1308Surface::getHeight()
+{
+  return m_height;
+}
+
+void SSD1308Surface::clear()
+{
+  memset(m_buffer, 0, (uint16_t)m_pages * m_width);
+  for (uint8_t page = 0; page < m_pages; page++)
+  {
+    markDirty(page, 0, m_width - 1);
+  }
+}
+
+void SSD1308Surface::setPixel(int16_t x, int16_t y, uint8_t color)
+{
+  if (x < 0 || y < 0 || x >= m_width || y >= m_height) return;
+  uint8_t* b = &m_buffer[(y >> 3) * m_width + x];
+  const uint8_t bit = 1 << (y & 7);
+  switch (color)
+  {
+    case SSD1308_BLACK:  *b &= ~bit; break;
+    case SSD1308_WHITE:  *b |= bit;  break;
+    default:             *b ^= bit;  break;
+  }
+  markDirty(y >> 3, x, x);
+}
+
+bool SSD1308Surface::getPixel(int16_t x, int16_t y)
+{
+  if (x < 0 || y < 0 || x >= m_width || y >= m_height) return false;
+  return (m_buffer[(y >> 3) * m_width + x] >> (y & 7)) & 1;
+}
+
+void SSD1308Surface::drawHLine(int16_t x, int16_t y, int16_t w, uint8_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
+
+void SSD1308Surface::drawVLine(int16_t x, int16_t y, int16_t h, uint8_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+// Bresenham; straight lines take the masked span path
+void SSD1308Surface::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
+{
+  if (y0 == y1)
+  {
+    if (x1 < x0) { int16_t t = x0; x0 = x1; x1 = t; }
+    fillRect(x0, y0, x1 - x0 + 1, 1, color);
+    return;
+  }
+  if (x0 == x1)
+  {
+    if (y1 < y0) { int16_t t = y0; y0 = y1; y1 = t; }
+    fillRect(x0, y0, 1, y1 - y0 + 1, color);
+    return;
+  }
+
+  const int16_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+  const int16_t dy = y1 > y0 ? y0 - y1 : y1 - y0;
+  const int8_t sx = x0 < x1 ? 1 : -1;
+  const int8_t sy = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+  for (;;)
+  {
+    setPixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1) break;
+    const int16_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+// the sides skip the corner rows so SSD1308_INVERT does not toggle them twice
+void SSD1308Surface::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color)
+{
+  if (w <= 0 || h <= 0) return;
+  fillRect(x, y, w, 1, color);
+  if (h > 1) fillRect(x, y + h - 1, w, 1, color);
+  if (h > 2)
+  {
+    fillRect(x, y + 1, 1, h - 2, color);
+    if (w > 1) fillRect(x + w - 1, y + 1, 1, h - 2, color);
+  }
+}
+
+// one mask per page; whole-byte spans become a memset
+void SSD1308Surface::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color)
+{
+  int16_t x1 = x + w;
+  int16_t y1 = y + h;
+  if (x < 0) x = 0;
+  if (y < 0) y = 0;
+  if (x1 > m_width) x1 = m_width;
+  if (y1 > m_height) y1 = m_height;
+  if (x >= x1 || y >= y1) return;
+
+  const uint8_t n = x1 - x;
+  const uint8_t firstPage = y >> 3;
+  const uint8_t lastPage = (y1 - 1) >> 3;
+  for (uint8_t page = firstPage; page <= lastPage; page++)
+  {
+    uint8_t mask = 0xFF;
+    if (page == firstPage) mask &= 0xFF << (y & 7);
+    if (page == lastPage) mask &= 0xFF >> (7 - ((y1 - 1) & 7));
+
+    uint8_t* row = &m_buffer[page * m_width + x];
+    if (mask == 0xFF && color != SSD1308_INVERT)
+    {
+      memset(row, color == SSD1308_WHITE ? 0xFF : 0x00, n);
+    }
+    else
+    {
+      uint8_t i;
+      switch (color)
+      {
+        case SSD1308_BLACK:  for (i = 0; i < n; i++) row[i] &= ~mask; break;
+        case SSD1308_WHITE:  for (i = 0; i < n; i++) row[i] |= mask;  break;
+        default:             for (i = 0; i < n; i++) row[i] ^= mask;  break;
+      }
+    }
+    markDirty(page, x, x1 - 1);
+  }
+}
+
+void SSD1308Surface::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, uint8_t color, bool opaque)
+{
+  blit(x, y, bitmap, w, h, color, opaque, false);
+}
+
+void SSD1308Surface::drawBitmap_P(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, uint8_t color, bool opaque)
+{
+  blit(x, y, bitmap, w, h, color, opaque, true);
+}
+
+int16_t SSD1308Surface::drawChar(int16_t x, int16_t y, char chr, uint8_t color, bool opaque)
+{
+  uint8_t index = (uint8_t)chr - 0x20;
+  if (index >= GLYPH_COUNT) index = 0; // unprintable: blank
+  blit(x, y, fontData[index], GLYPH_WIDTH, 8, color, opaque, true);
+  return x + GLYPH_WIDTH;
+}
+
+int16_t SSD1308Surface::drawText(int16_t x, int16_t y, const char* text, uint8_t color, bool opaque)
+{
+  while (*text && x < m_width)
+  {
+    x = drawChar(x, y, *text++, color, opaque);
+  }
+  return x;
+}
+
+// Each source column byte is shifted into a 16-bit word covering the two
+// destination pages it overlaps, then combined as d = ((d & ~clr) | set) ^ tog.
+void SSD1308Surface::blit(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, uint8_t color, bool opaque, bool progmem)
+{
+  const int16_t first = x < 0 ? -x : 0;                     // first visible source column
+  const int16_t last = x + w > m_width ? m_width - x : w;   // one past the last
+  if (first >= last) return;
+
+  const uint8_t srcPages = (h + 7) >> 3;
+  for (uint8_t sp = 0; sp < srcPages; sp++)
+  {
+    const int16_t top = y + sp * 8;
+    const int16_t page = top >> 3;
+    const uint8_t shift = top & 7;
+    if (page >= m_pages || page < -1) continue;
+
+    const uint8_t rows = h - sp * 8;
+    const uint8_t colMask = rows >= 8 ? 0xFF : (1 << rows) - 1;
+    const uint16_t mask = (uint16_t)colMask << shift;
+    const bool lo = page >= 0;
+    const bool hi = page + 1 < m_pages && (mask >> 8);
+    const int16_t base = page * m_width + x;
+    const uint8_t* src = bitmap + sp * w;
+
+    for (int16_t i = first; i < last; i++)
+    {
+      const uint8_t b = progmem ? pgm_read_byte(src + i) : src[i];
+      const uint16_t bits = (uint16_t)(b & colMask) << shift;
+      uint16_t set = 0, clr = 0, tog = 0;
+      switch (color)
+      {
+        case SSD1308_BLACK:
+          clr = bits;
+          if (opaque) set = mask & ~bits;
+          break;
+        case SSD1308_WHITE:
+          set = bits;
+          if (opaque) clr = mask;
+          break;
+        default:
+          tog = bits;
+          break;
+      }
+      if (lo)
+      {
+        uint8_t* d = &m_buffer[base + i];
+        *d = ((*d & ~clr) | set) ^ tog;
+      }
+      if (hi)
+      {
+        uint8_t* d = &m_buffer[base + m_width + i];
+        *d = ((*d & ~(clr >> 8)) | (set >> 8)) ^ (tog >> 8);
+      }
+    }
+    if (lo) markDirty(page, x + first, x + last - 1);
+    if (hi) markDirty(page + 1, x + first, x + last - 1);
+  }
+}
+
+void SSD1308Surface::markDirty(uint8_t page, uint8_t start, uint8_t end)
+{
+  if (!m_dirtyStart) return;
+  if (start < m_dirtyStart[page]) m_dirtyStart[page] = start;
+  if (end > m_dirtyEnd[page]) m_dirtyEnd[page] = end;
+}
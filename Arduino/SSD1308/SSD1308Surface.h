@@ -0,0 +1,94 @@
+// I2Cdev library collection - SSD1308 1-bpp drawing surface header file
+// Based on Solomon Systech SSD1308 datasheet, rev. 1, 10/2008 (GDDRAM layout)
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _SSD1308SURFACE_H_
+#define _SSD1308SURFACE_H_
+
+#include <inttypes.h>
+
+#define SSD1308_BLACK   0   // clear pixels
+#define SSD1308_WHITE   1   // set pixels
+#define SSD1308_INVERT  2   // toggle pixels
+
+// Drawing into a 1-bpp page-packed buffer, the SSD1308 GDDRAM layout: one byte
+// per column per 8-row page, bit 0 at the top. Sources for drawBitmap() use the
+// same layout, so glyphs and bitmaps are blitted a whole column byte at a time
+// (shifted into a 16-bit word that straddles two pages), and filled spans are
+// masked per page rather than per pixel. Coordinates may be partly or wholly
+// off the surface; everything is clipped.
+class SSD1308Surface
+{
+  public:
+    SSD1308Surface(uint8_t* buffer, uint8_t width, uint8_t height);
+
+    // optional per-page changed-column ranges, widened by every draw call.
+    // start[page] > end[page] means the page is clean.
+    void setDirtyTracking(uint8_t* start, uint8_t* end);
+
+    uint8_t* getBuffer();
+    uint8_t getWidth();
+    uint8_t getHeight();
+
+    void clear();
+    void setPixel(int16_t x, int16_t y, uint8_t color);
+    bool getPixel(int16_t x, int16_t y);
+
+    void drawHLine(int16_t x, int16_t y, int16_t w, uint8_t color);
+    void drawVLine(int16_t x, int16_t y, int16_t h, uint8_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color);
+
+    // bitmap is page-packed, ((h + 7) / 8) pages of w bytes. with opaque set,
+    // 0 bits paint the opposite colour instead of leaving the surface alone.
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, uint8_t color, bool opaque = false);
+    void drawBitmap_P(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, uint8_t color, bool opaque = false);
+
+    // fontData glyphs, 8x8 cells; returns the x position after the text
+    int16_t drawChar(int16_t x, int16_t y, char chr, uint8_t color, bool opaque = false);
+    int16_t drawText(int16_t x, int16_t y, const char* text, uint8_t color, bool opaque = false);
+
+  private:
+    void blit(int16_t x, int16_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, uint8_t color, bool opaque, bool progmem);
+    void markDirty(uint8_t page, uint8_t start, uint8_t end);
+
+    uint8_t* m_buffer;
+    uint8_t m_width;
+    uint8_t m_height;
+    uint8_t m_pages;
+    uint8_t* m_dirtyStart;
+    uint8_t* m_dirtyEnd;
+};
+
+#endif
@@ -0,0 +1,134 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for SlowPoller class
+// 10/19/2026
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Streams 100Hz gyro/accel frames from an ITG3200 + ADXL345 board while an
+// iAQ-2000, LM73, BMP085 and AD7746 on the same bus are polled in the gaps.
+// The slow sensors are only touched when no IMU frame is waiting, and their
+// values are printed from the cache once a second without any bus access.
+// Wire the ITG3200 INT pin to Arduino digital pin 2 (external interrupt 0).
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev and all device classes must be installed as libraries, or else the
+// .cpp/.h files for all classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "ITG3200.h"
+#include "ADXL345.h"
+#include "IMU6DOF.h"
+#include "IAQ2000.h"
+#include "LM73.h"
+#include "BMP085.h"
+#include "AD7746.h"
+#include "SlowPoller.h"
+
+ITG3200 gyro;
+ADXL345 accel;
+IMU6DOF imu(&gyro, &accel);
+IMU6DOFFrame frame;
+
+IAQ2000 iaq;
+LM73 lm73;
+BMP085 barometer;
+AD7746 cdc;
+SlowPoller poller;
+
+const uint8_t vtSetups[] = { AD7746_VTEN | AD7746_VTMD_INT_TEMP };
+uint32_t frames = 0;
+uint32_t lastReport = 0;
+
+void imuDataReady() {
+    imu.dataReady();
+}
+
+void printAge(uint8_t sensor) {
+    uint32_t age = poller.getAge(sensor);
+    Serial.print(" (");
+    if (age == SLOWPOLLER_NEVER) Serial.print("none");
+    else { Serial.print(age); Serial.print("ms"); }
+    Serial.println(")");
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Serial.begin(115200);
+
+    // initialize devices
+    Serial.println("Initializing I2C devices...");
+    gyro.initialize();
+    accel.initialize();
+    iaq.initialize();
+    lm73.initialize();
+    barometer.initialize();
+    cdc.initialize();
+
+    gyro.setDLPFBandwidth(ITG3200_DLPF_BW_42);
+    imu.initialize(9);
+    attachInterrupt(0, imuDataReady, RISING);
+
+    // capacitance on CIN1 with EXCA, internal temperature on the VT slot
+    cdc.writeCapSetupRegister(AD7746_CAPEN);
+    cdc.writeExcSetupRegister(AD7746_EXCA | AD7746_EXCLVL_VDD_X_1_2);
+    cdc.startStream(AD7746_VTF_62P1 | AD7746_CAPF_11P0, vtSetups, 1);
+
+    poller.attachIAQ2000(&iaq);
+    poller.attachLM73(&lm73, 0.0625f, 2000);
+    poller.attachBMP085(&barometer, BMP085_MODE_PRESSURE_1);
+    poller.attachAD7746(&cdc);
+}
+
+void loop() {
+    // the IMU always goes first; slow sensors only get the bus when it is idle
+    if (imu.getFrame(&frame)) {
+        frames++;
+        return;
+    }
+    poller.update();
+
+    if (millis() - lastReport < 1000) return;
+    lastReport = millis();
+
+    Serial.print("IMU frames:\t"); Serial.println(frames);
+    Serial.print("iAQ ppm:\t"); Serial.print(poller.getIaq());
+    Serial.print(" status "); Serial.print(poller.getIaqStatus(), HEX);
+    printAge(SLOWPOLLER_IAQ2000);
+    Serial.print("LM73 C:\t\t"); Serial.print(poller.getLM73Temperature());
+    printAge(SLOWPOLLER_LM73);
+    Serial.print("BMP085 Pa:\t"); Serial.print(poller.getPressure());
+    printAge(SLOWPOLLER_BMP085);
+    Serial.print("AD7746 cap:\t"); Serial.print(poller.getCapacitance());
+    printAge(SLOWPOLLER_AD7746);
+    Serial.print("AD7746 temp:\t"); Serial.print(poller.getVtValue());
+    printAge(SLOWPOLLER_AD7746_VT);
+    frames = 0;
+}
@@ -0,0 +1,335 @@
+// I2Cdev library collection - rate-limited background poller for slow sensors
+// Based on AppliedSensor iAQ-2000, TI LM73, Bosch BMP085 and Analog Devices AD7746 datasheets
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "SlowPoller.h"
+
+/** Constructor.
+ * No sensor is polled until it is attached.
+ */
+SlowPoller::SlowPoller() {
+    iaq2000 = 0;
+    lm73 = 0;
+    bmp085 = 0;
+    ad7746 = 0;
+    lm73Accuracy = 0.25f;
+    bmp085Mode = BMP085_MODE_PRESSURE_3;
+    for (uint8_t i = 0; i < SLOWPOLLER_SENSORS; i++) {
+        due[i] = 0;
+        cycleStart[i] = 0;
+        interval[i] = 0;
+        state[i] = 0;
+    }
+    next = 0;
+    valid = 0;
+    iaq = 0;
+    iaqStatus = IAQ2000_STATUS_RUNIN;
+    iaqResistance = 0;
+    tvoc = 0;
+    lm73Temperature = 0;
+    bmp085Temperature = 0;
+    pressure = 0;
+    capacitance = 0;
+    vtValue = 0;
+    vtChannel = 0;
+}
+
+/** Poll an iAQ-2000 in the background.
+ * The whole 9-byte frame is read once per interval. Frames flagged busy or
+ * error are dropped (only the status is kept), so the cached values and
+ * their age always come from a usable frame.
+ * @param device Initialized IAQ2000 driver
+ * @param interval Milliseconds between frame reads, 0 to stop polling
+ * @see IAQ2000::getFrame()
+ */
+void SlowPoller::attachIAQ2000(IAQ2000 *device, uint16_t interval) {
+    iaq2000 = device;
+    schedule(SLOWPOLLER_IAQ2000, interval);
+}
+
+/** Poll an LM73 in the background.
+ * Each cycle triggers a one-shot conversion and collects it once the
+ * conversion time has passed, so the part stays powered down in between.
+ * @param device Initialized LM73 driver
+ * @param accuracy Required resolution in degrees C (0.25 to 0.03125)
+ * @param interval Milliseconds between conversions, 0 to stop polling
+ * @see LM73::triggerOneShot()
+ */
+void SlowPoller::attachLM73(LM73 *device, float accuracy, uint16_t interval) {
+    lm73 = device;
+    lm73Accuracy = accuracy;
+    schedule(SLOWPOLLER_LM73, interval);
+}
+
+/** Poll a BMP085 in the background.
+ * Each cycle runs a temperature and then a pressure conversion. Neither
+ * conversion delay blocks; the poller just comes back when it has passed.
+ * @param device Initialized BMP085 driver (calibration loaded)
+ * @param pressureMode BMP085_MODE_PRESSURE_0 to BMP085_MODE_PRESSURE_3
+ * @param interval Milliseconds between cycles, 0 to stop polling
+ */
+void SlowPoller::attachBMP085(BMP085 *device, uint8_t pressureMode, uint16_t interval) {
+    bmp085 = device;
+    bmp085Mode = pressureMode;
+    schedule(SLOWPOLLER_BMP085, interval);
+}
+
+/** Poll an AD7746 in the background.
+ * The stream must already be running (see AD7746::startStream()). Each
+ * poll moves finished conversions into the driver's ring buffer and keeps
+ * the latest capacitance and VT result. This takes the samples out of the
+ * driver's buffer, so do not also call AD7746::readSample().
+ * @param device AD7746 driver with a running stream
+ * @param interval Milliseconds between status polls, 0 to stop polling
+ * @see AD7746::pollStream()
+ */
+void SlowPoller::attachAD7746(AD7746 *device, uint16_t interval) {
+    ad7746 = device;
+    schedule(SLOWPOLLER_AD7746, interval);
+}
+
+/** Change the polling interval of an attached sensor.
+ * The next cycle starts right away.
+ * @param sensor SLOWPOLLER_IAQ2000, _LM73, _BMP085 or _AD7746
+ * @param interval Milliseconds between cycles, 0 to stop polling
+ */
+void SlowPoller::setInterval(uint8_t sensor, uint16_t interval) {
+    if (sensor >= SLOWPOLLER_SENSORS || !attached(sensor)) return;
+    schedule(sensor, interval);
+}
+
+/** Do one step of background polling.
+ * Call from loop() whenever the time-critical work is done, e.g. when the
+ * IMU has no sample pending. At most one sensor is serviced per call, and
+ * each step is one or two short transfers; conversion delays are never
+ * waited out. Sensors that are due are served round-robin.
+ * @return Sensor id serviced, or SLOWPOLLER_NONE if nothing was due
+ */
+uint8_t SlowPoller::update() {
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < SLOWPOLLER_SENSORS; i++) {
+        uint8_t sensor = next + i;
+        if (sensor >= SLOWPOLLER_SENSORS) sensor -= SLOWPOLLER_SENSORS;
+        if (!interval[sensor] || !attached(sensor) || (int32_t)(now - due[sensor]) < 0) continue;
+        step(sensor, now);
+        next = sensor + 1 < SLOWPOLLER_SENSORS ? sensor + 1 : 0;
+        return sensor;
+    }
+    return SLOWPOLLER_NONE;
+}
+
+/** Get the age of a cached value.
+ * @param sensor SLOWPOLLER_IAQ2000, _LM73, _BMP085, _AD7746 or _AD7746_VT
+ * @return Milliseconds since the value was read, SLOWPOLLER_NEVER if it
+ *         has not been read yet
+ */
+uint32_t SlowPoller::getAge(uint8_t sensor) {
+    if (sensor >= SLOWPOLLER_VALUES || !(valid & (1 << sensor))) return SLOWPOLLER_NEVER;
+    return millis() - updated[sensor];
+}
+
+/** Get the cached iAQ-2000 CO2 prediction.
+ * @return CO2 equivalent in ppm
+ */
+uint16_t SlowPoller::getIaq() {
+    return iaq;
+}
+
+/** Get the status of the most recent iAQ-2000 frame.
+ * Unlike the other values this is also updated for busy or error frames.
+ * @return IAQ2000_STATUS_OK, _BUSY, _RUNIN or _ERROR
+ */
+uint8_t SlowPoller::getIaqStatus() {
+    return iaqStatus;
+}
+
+/** Get the cached iAQ-2000 sensor resistance.
+ * @return Resistance in Ohm
+ */
+uint32_t SlowPoller::getIaqResistance() {
+    return iaqResistance;
+}
+
+/** Get the cached iAQ-2000 TVOC prediction.
+ * @return TVOC equivalent in ppb
+ */
+uint16_t SlowPoller::getTvoc() {
+    return tvoc;
+}
+
+/** Get the cached LM73 temperature.
+ * @return Temperature in degrees C
+ */
+float SlowPoller::getLM73Temperature() {
+    return lm73Temperature;
+}
+
+/** Get the cached BMP085 temperature.
+ * Read in the same cycle as getPressure(), so both share one age.
+ * @return Temperature in degrees C
+ */
+float SlowPoller::getBMP085Temperature() {
+    return bmp085Temperature;
+}
+
+/** Get the cached BMP085 pressure.
+ * @return Pressure in Pa
+ */
+float SlowPoller::getPressure() {
+    return pressure;
+}
+
+/** Get the cached AD7746 capacitance result.
+ * @return Raw 24-bit conversion result
+ */
+uint32_t SlowPoller::getCapacitance() {
+    return capacitance;
+}
+
+/** Get the cached AD7746 voltage/temperature result.
+ * @return Raw 24-bit conversion result
+ * @see getVtChannel()
+ * @see getAge(SLOWPOLLER_AD7746_VT)
+ */
+uint32_t SlowPoller::getVtValue() {
+    return vtValue;
+}
+
+/** Get the VT setup that produced getVtValue().
+ * @return VT setup register value, as in AD7746Sample::channel
+ */
+uint8_t SlowPoller::getVtChannel() {
+    return vtChannel;
+}
+
+bool SlowPoller::attached(uint8_t sensor) {
+    switch (sensor) {
+        case SLOWPOLLER_IAQ2000: return iaq2000 != 0;
+        case SLOWPOLLER_LM73: return lm73 != 0;
+        case SLOWPOLLER_BMP085: return bmp085 != 0;
+        case SLOWPOLLER_AD7746: return ad7746 != 0;
+    }
+    return false;
+}
+
+void SlowPoller::schedule(uint8_t sensor, uint16_t interval) {
+    this -> interval[sensor] = interval;
+    state[sensor] = 0;
+    due[sensor] = millis();
+}
+
+// one step of a sensor's read cycle. multi-step cycles (LM73, BMP085) set due
+// to the end of the conversion they just started, and the next cycle is timed
+// from the start of this one so the interval does not drift.
+void SlowPoller::step(uint8_t sensor, uint32_t now) {
+    switch (sensor) {
+        case SLOWPOLLER_IAQ2000: {
+            uint16_t frameIaq, frameTvoc;
+            uint8_t frameStatus;
+            uint32_t frameResistance;
+            if (iaq2000 -> getFrame(&frameIaq, &frameStatus, &frameResistance, &frameTvoc)) {
+                iaqStatus = frameStatus;
+                if (!(frameStatus & (IAQ2000_STATUS_BUSY | IAQ2000_STATUS_ERROR))) {
+                    iaq = frameIaq;
+                    iaqResistance = frameResistance;
+                    tvoc = frameTvoc;
+                    store(SLOWPOLLER_IAQ2000, now);
+                }
+            }
+            due[sensor] = now + interval[sensor];
+            break;
+        }
+
+        case SLOWPOLLER_LM73:
+            if (state[sensor] == 0) {
+                cycleStart[sensor] = now;
+                due[sensor] = now + lm73 -> triggerOneShot(lm73Accuracy);
+                state[sensor] = 1;
+            } else if (lm73 -> getOneShotTemp(&lm73Temperature)) {
+                store(SLOWPOLLER_LM73, now);
+                due[sensor] = cycleStart[sensor] + interval[sensor];
+                state[sensor] = 0;
+            } else if (lm73 -> isConversionPending()) {
+                // the LM73 starts its timer after the trigger write, so millis()
+                // may have ticked since due was set; try again shortly
+                due[sensor] = now + 1;
+            } else {
+                // conversion was collected elsewhere, start a new one
+                due[sensor] = now;
+                state[sensor] = 0;
+            }
+            break;
+
+        case SLOWPOLLER_BMP085:
+            if (state[sensor] == 0) {
+                cycleStart[sensor] = now;
+                bmp085 -> setControl(BMP085_MODE_TEMPERATURE);
+                due[sensor] = now + bmp085 -> getMeasureDelayMilliseconds();
+                state[sensor] = 1;
+            } else if (state[sensor] == 1) {
+                // temperature has to be read first, it sets up the pressure compensation
+                bmp085Temperature = bmp085 -> getTemperatureC();
+                bmp085 -> setControl(bmp085Mode);
+                due[sensor] = now + bmp085 -> getMeasureDelayMilliseconds();
+                state[sensor] = 2;
+            } else {
+                pressure = bmp085 -> getPressure();
+                store(SLOWPOLLER_BMP085, now);
+                due[sensor] = cycleStart[sensor] + interval[sensor];
+                state[sensor] = 0;
+            }
+            break;
+
+        case SLOWPOLLER_AD7746: {
+            AD7746Sample sample;
+            ad7746 -> pollStream();
+            while (ad7746 -> readSample(&sample)) {
+                if (sample.channel == AD7746_CHANNEL_CAP) {
+                    capacitance = sample.value;
+                    store(SLOWPOLLER_AD7746, now);
+                } else {
+                    vtValue = sample.value;
+                    vtChannel = sample.channel;
+                    store(SLOWPOLLER_AD7746_VT, now);
+                }
+            }
+            due[sensor] = now + interval[sensor];
+            break;
+        }
+    }
+}
+
+void SlowPoller::store(uint8_t value, uint32_t now) {
+    updated[value] = now;
+    valid |= 1 << value;
+}
@@ -0,0 +1,119 @@
+// I2Cdev library collection - rate-limited background poller for slow sensors header file
+// Based on AppliedSensor iAQ-2000, TI LM73, Bosch BMP085 and Analog Devices AD7746 datasheets
+// 10/19/2026
+//
+// This I2C device library is using (and submitted as a part of) Jeff Rowberg's I2Cdevlib library,
+// which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2026 I2Cdevlib contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _SLOWPOLLER_H_
+#define _SLOWPOLLER_H_
+
+#include "IAQ2000.h"
+#include "LM73.h"
+#include "BMP085.h"
+#include "AD7746.h"
+
+// sensor ids for setInterval(), getAge() and update()
+#define SLOWPOLLER_IAQ2000              0
+#define SLOWPOLLER_LM73                 1
+#define SLOWPOLLER_BMP085               2
+#define SLOWPOLLER_AD7746               3       // capacitance result
+#define SLOWPOLLER_AD7746_VT            4       // voltage/temperature result, getAge() only
+#define SLOWPOLLER_SENSORS              4       // scheduled sensors
+#define SLOWPOLLER_VALUES               5       // cached values with their own age
+#define SLOWPOLLER_NONE                 0xFF    // update() did nothing
+
+#define SLOWPOLLER_NEVER                0xFFFFFFFF  // getAge() before the first value
+
+// default intervals in ms, at the rate each part produces new data
+#define SLOWPOLLER_IAQ2000_INTERVAL     1000    // frame refreshed once per second
+#define SLOWPOLLER_LM73_INTERVAL        1000
+#define SLOWPOLLER_BMP085_INTERVAL      1000
+#define SLOWPOLLER_AD7746_INTERVAL      10      // status poll, conversions take 11ms or more
+
+class SlowPoller {
+    public:
+        SlowPoller();
+
+        void attachIAQ2000(IAQ2000 *device, uint16_t interval=SLOWPOLLER_IAQ2000_INTERVAL);
+        void attachLM73(LM73 *device, float accuracy=0.25f, uint16_t interval=SLOWPOLLER_LM73_INTERVAL);
+        void attachBMP085(BMP085 *device, uint8_t pressureMode=BMP085_MODE_PRESSURE_3, uint16_t interval=SLOWPOLLER_BMP085_INTERVAL);
+        void attachAD7746(AD7746 *device, uint16_t interval=SLOWPOLLER_AD7746_INTERVAL);
+        void setInterval(uint8_t sensor, uint16_t interval);
+
+        uint8_t update();
+
+        uint32_t getAge(uint8_t sensor);
+        uint16_t getIaq();
+        uint8_t getIaqStatus();
+        uint32_t getIaqResistance();
+        uint16_t getTvoc();
+        float getLM73Temperature();
+        float getBMP085Temperature();
+        float getPressure();
+        uint32_t getCapacitance();
+        uint32_t getVtValue();
+        uint8_t getVtChannel();
+
+    private:
+        IAQ2000 *iaq2000;
+        LM73 *lm73;
+        BMP085 *bmp085;
+        AD7746 *ad7746;
+        float lm73Accuracy;
+        uint8_t bmp085Mode;
+
+        uint32_t due[SLOWPOLLER_SENSORS];       // millis() of the next step
+        uint32_t cycleStart[SLOWPOLLER_SENSORS];
+        uint16_t interval[SLOWPOLLER_SENSORS];  // 0 disables the sensor
+        uint8_t state[SLOWPOLLER_SENSORS];      // step within a multi-step read
+        uint8_t next;                           // round-robin start for update()
+
+        uint32_t updated[SLOWPOLLER_VALUES];    // millis() when each value was cached
+        uint8_t valid;                          // bit per value id
+
+        uint16_t iaq;
+        uint8_t iaqStatus;
+        uint32_t iaqResistance;
+        uint16_t tvoc;
+        float lm73Temperature;
+        float bmp085Temperature;
+        float pressure;
+        uint32_t capacitance;
+        uint32_t vtValue;
+        uint8_t vtChannel;
+
+        bool attached(uint8_t sensor);
+        void schedule(uint8_t sensor, uint16_t interval);
+        void step(uint8_t sensor, uint32_t now);
+        void store(uint8_t value, uint32_t now);
+};
+
+#endif /* _SLOWPOLLER_H_ */
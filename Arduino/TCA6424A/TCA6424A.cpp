@@ -37,6 +37,16 @@ THE SOFTWARE.
  */
 TCA6424A::TCA6424A() {
     devAddr = TCA6424A_DEFAULT_ADDRESS;
+    outputShadow[0] = outputShadow[1] = outputShadow[2] = 0xFF;
+    directionShadow[0] = directionShadow[1] = directionShadow[2] = 0xFF;
+    outputDirty = directionDirty = 0;
+    autoCommit = true;
+    inputSnapshot[0] = inputSnapshot[1] = inputSnapshot[2] = 0;
+    inputSnapshotValid = false;
+    interruptDriven = interruptPending = false;
+    interruptTime = 0;
+    eventHead = eventTail = 0;
+    eventsDropped = 0;
 }
 
 /** Specific address constructor.
@@ -47,14 +57,29 @@ TCA6424A::TCA6424A() {
  */
 TCA6424A::TCA6424A(uint8_t address) {
     devAddr = address;
+    outputShadow[0] = outputShadow[1] = outputShadow[2] = 0xFF;
+    directionShadow[0] = directionShadow[1] = directionShadow[2] = 0xFF;
+    outputDirty = directionDirty = 0;
+    autoCommit = true;
+    inputSnapshot[0] = inputSnapshot[1] = inputSnapshot[2] = 0;
+    inputSnapshotValid = false;
+    interruptDriven = interruptPending = false;
+    interruptTime = 0;
+    eventHead = eventTail = 0;
+    eventsDropped = 0;
 }
 
 /** Power on and prepare for general usage.
  * The TCA6424A I/O expander requires no preparation after power-on. All pins
  * will be default to INPUT mode, and the device is ready for usage immediately.
- * This is an empty function for consistency and/or future expansion.
+ * The output and direction shadows are loaded from the device, so they are
+ * also correct after a host-only reset.
  */
 void TCA6424A::initialize() {
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, outputShadow);
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, directionShadow);
+    inputSnapshotValid = I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0 | TCA6424A_AUTO_INCREMENT, 3, inputSnapshot) == 3;
+    outputDirty = directionDirty = 0;
 }
 
 /** Verify the I2C connection.
@@ -145,24 +170,38 @@ void TCA6424A::getAllOutputLevel(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2)
     *bank2 = buffer[2];
 }
 /** Set a single OUTPUT pin's logic level.
+ * The bank value comes from the output shadow, so this is one register
+ * write (or, with auto-commit disabled, no bus traffic until commit()).
  * @param pin Which pin to write (0-23)
  * @param value New pin output logic level (0 or 1)
+ * @see setAutoCommit()
  */
 void TCA6424A::writePin(uint16_t pin, bool value) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_OUTPUT0 + (pin / 8), pin % 8, value);
+    if (pin > 23) return;
+    const uint8_t bank = pin / 8;
+    if (value) {
+        outputShadow[bank] |= 1 << (pin % 8);
+    } else {
+        outputShadow[bank] &= ~(1 << (pin % 8));
+    }
+    outputDirty |= 1 << bank;
+    if (autoCommit) commit();
 }
 /** Set all OUTPUT pins' logic levels in one bank.
  * @param bank Which bank to write (0/1/2 for P0*, P1*, P2* respectively)
  * @param value New pins' output logic level (0 or 1 for each pin)
  */
 void TCA6424A::writeBank(uint8_t bank, uint8_t value) {
-    I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, value);
+    if (bank > 2) return;
+    outputShadow[bank] = value;
+    outputDirty |= 1 << bank;
+    if (autoCommit) commit();
 }
 /** Set all OUTPUT pins' logic levels in all banks.
  * @param banks All pins' new logic values (P00-P27) in 3-byte array
  */
 void TCA6424A::writeAll(uint8_t *banks) {
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks);
+    writeAll(banks[0], banks[1], banks[2]);
 }
 /** Set all OUTPUT pins' logic levels in all banks.
  * @param bank0 Bank 0's new logic values (P00-P07)
@@ -170,10 +209,175 @@ void TCA6424A::writeAll(uint8_t *banks) {
  * @param bank2 Bank 2's new logic values (P20-P27)
  */
 void TCA6424A::writeAll(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
-    buffer[0] = bank0;
-    buffer[1] = bank1;
-    buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    outputShadow[0] = bank0;
+    outputShadow[1] = bank1;
+    outputShadow[2] = bank2;
+    outputDirty = 0x07;
+    if (autoCommit) commit();
+}
+/** Set any combination of OUTPUT pins' logic levels at once.
+ * Only pins with their mask bit set change; all of them change in the same
+ * register burst, so the new levels appear together on the bus (within one
+ * I2C byte time between banks). Bit n of mask/values is pin n (P00 = bit 0,
+ * P27 = bit 23).
+ * @param mask Pins to change
+ * @param values New logic levels for the masked pins
+ */
+void TCA6424A::writeAll(uint32_t mask, uint32_t values) {
+    for (uint8_t bank = 0; bank < 3; bank++, mask >>= 8, values >>= 8) {
+        const uint8_t m = mask & 0xFF;
+        if (!m) continue;
+        const uint8_t level = (outputShadow[bank] & ~m) | (values & m);
+        if (level != outputShadow[bank]) {
+            outputShadow[bank] = level;
+            outputDirty |= 1 << bank;
+        }
+    }
+    if (autoCommit) commit();
+}
+
+// OUTPUT/CONFIG shadow
+
+/** Choose whether output/direction writes go to the device immediately.
+ * With auto-commit disabled, writePin(), writeBank(), writeAll(),
+ * setPinDirection(), setBankDirection() and setAllDirection() only update
+ * the local shadow registers, and commit() sends every change at once.
+ * Enabled by default.
+ * @param enabled True to write through on every call
+ */
+void TCA6424A::setAutoCommit(bool enabled) {
+    autoCommit = enabled;
+    if (enabled) commit();
+}
+/** Get the auto-commit setting.
+ * @return True if writes go to the device immediately
+ * @see setAutoCommit()
+ */
+bool TCA6424A::getAutoCommit() {
+    return autoCommit;
+}
+/** Write all changed shadow banks to the device.
+ * Output levels go first, then directions, so a pin switched to output
+ * drives the new level from the start. Each register group is written in
+ * one auto-increment burst covering its changed banks; nothing is sent if
+ * nothing changed. Banks whose write fails stay dirty and are sent again by
+ * the next commit(). If the output write fails, the directions are held
+ * back so no pin starts driving a stale level.
+ * @return True if every changed bank was written
+ */
+bool TCA6424A::commit() {
+    if (!writeShadow(TCA6424A_RA_OUTPUT0, outputShadow, &outputDirty)) return false;
+    return writeShadow(TCA6424A_RA_CONFIG0, directionShadow, &directionDirty);
+}
+/** Burst-write the span of dirty banks of one register group.
+ * The dirty bits are only cleared once the write succeeded.
+ */
+bool TCA6424A::writeShadow(uint8_t regAddr, uint8_t *shadow, uint8_t *dirty) {
+    if (!*dirty) return true;
+    const uint8_t first = (*dirty & 0x01) ? 0 : ((*dirty & 0x02) ? 1 : 2);
+    const uint8_t last = (*dirty & 0x04) ? 2 : ((*dirty & 0x02) ? 1 : 0);
+    bool ok;
+    if (first == last) {
+        ok = I2Cdev::writeByte(devAddr, regAddr + first, shadow[first]);
+    } else {
+        ok = I2Cdev::writeBytes(devAddr, (regAddr + first) | TCA6424A_AUTO_INCREMENT, last - first + 1, shadow + first);
+    }
+    if (ok) *dirty = 0;
+    return ok;
+}
+
+// input edge events
+
+/** Note an INT pin assertion.
+ * Call from the handler attached (FALLING) to the TCA6424A INT pin. Only
+ * records the time; the input registers are read by pollInputs(). Once this
+ * has been called, pollInputs() stays off the bus until the next interrupt.
+ */
+void TCA6424A::interrupt() {
+    interruptTime = micros();
+    interruptPending = true;
+    interruptDriven = true;
+}
+/** Read all input banks and queue an event for every pin that changed.
+ * One 3-byte burst, which also releases INT. The result is XORed against
+ * the previous snapshot; pins configured as outputs (per the direction
+ * shadow) are ignored. Each changed input gets a TCA6424A_EDGE_RISING or
+ * TCA6424A_EDGE_FALLING event stamped with the interrupt time.
+ * Without an INT pin, call this periodically instead. If initialize() was
+ * not called, the first successful read only takes the baseline snapshot and
+ * queues nothing, so inputs that are already high do not show up as edges.
+ * @return True if the inputs were read
+ */
+bool TCA6424A::pollInputs() {
+    if (interruptDriven && !interruptPending) return false;
+    uint32_t timestamp = micros();
+    if (interruptDriven) {
+        noInterrupts();
+        timestamp = interruptTime;
+        interruptPending = false;
+        interrupts();
+    }
+    if (I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer) != 3) {
+        // only a successful input read releases INT, so no new edge will come
+        if (interruptDriven) interruptPending = true;
+        return false;
+    }
+    if (!inputSnapshotValid) {
+        inputSnapshot[0] = buffer[0];
+        inputSnapshot[1] = buffer[1];
+        inputSnapshot[2] = buffer[2];
+        inputSnapshotValid = true;
+        return true;
+    }
+
+    for (uint8_t bank = 0; bank < 3; bank++) {
+        uint8_t changed = (buffer[bank] ^ inputSnapshot[bank]) & directionShadow[bank];
+        inputSnapshot[bank] = buffer[bank];
+        for (uint8_t bit = 0; changed; bit++, changed >>= 1) {
+            if (!(changed & 1)) continue;
+            const uint8_t head = eventHead;
+            if ((uint8_t)(head - eventTail) == TCA6424A_EVENT_QUEUE_SIZE) {
+                eventsDropped++;
+                continue;
+            }
+            volatile TCA6424AEvent *event = &eventQueue[head & (TCA6424A_EVENT_QUEUE_SIZE - 1)];
+            event -> timestamp = timestamp;
+            event -> pin = bank * 8 + bit;
+            event -> edge = (buffer[bank] >> bit) & 1 ? TCA6424A_EDGE_RISING : TCA6424A_EDGE_FALLING;
+            eventHead = head + 1; // publish only after the slot is filled
+        }
+    }
+    return true;
+}
+/** Take the oldest input edge event from the queue.
+ * Safe to call from a different context than pollInputs() (one reader, one
+ * writer, no locking).
+ * @param event Output event
+ * @return True if an event was returned, false if the queue is empty
+ */
+bool TCA6424A::readEvent(TCA6424AEvent *event) {
+    const uint8_t tail = eventTail;
+    if (tail == eventHead) return false;
+    volatile TCA6424AEvent *slot = &eventQueue[tail & (TCA6424A_EVENT_QUEUE_SIZE - 1)];
+    event -> timestamp = slot -> timestamp;
+    event -> pin = slot -> pin;
+    event -> edge = slot -> edge;
+    eventTail = tail + 1; // free the slot only after the copy
+    return true;
+}
+/** Get the number of queued input edge events.
+ * @return Event count (0 to TCA6424A_EVENT_QUEUE_SIZE)
+ */
+uint8_t TCA6424A::getEventCount() {
+    return (uint8_t)(eventHead - eventTail);
+}
+/** Get the number of edge events lost because the queue was full.
+ * The newest events are the ones dropped, so the snapshot still tracks the
+ * pins and later edges are reported correctly.
+ * @return Dropped event count
+ */
+uint16_t TCA6424A::getDroppedEvents() {
+    return eventsDropped;
 }
 
 // POLARITY* registers (x8h - xAh)
@@ -281,24 +485,37 @@ void TCA6424A::getAllDirection(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2) {
     *bank2 = buffer[2];
 }
 /** Set a single pin's direction (I/O) setting.
+ * Uses the direction shadow instead of a read-modify-write.
  * @param pin Which pin to write (0-23)
  * @param direction Pin direction setting (0 or 1)
+ * @see setAutoCommit()
  */
 void TCA6424A::setPinDirection(uint16_t pin, bool direction) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_CONFIG0 + (pin / 8), pin % 8, direction);
+    if (pin > 23) return;
+    const uint8_t bank = pin / 8;
+    if (direction) {
+        directionShadow[bank] |= 1 << (pin % 8);
+    } else {
+        directionShadow[bank] &= ~(1 << (pin % 8));
+    }
+    directionDirty |= 1 << bank;
+    if (autoCommit) commit();
 }
 /** Set all pin direction (I/O) settings in one bank.
  * @param bank Which bank to read (0/1/2 for P0*, P1*, P2* respectively)
  * @param direction New pins' direction settings (0 or 1 for each pin)
  */
 void TCA6424A::setBankDirection(uint8_t bank, uint8_t direction) {
-    I2Cdev::writeByte(devAddr, TCA6424A_RA_CONFIG0 + bank, direction);
+    if (bank > 2) return;
+    directionShadow[bank] = direction;
+    directionDirty |= 1 << bank;
+    if (autoCommit) commit();
 }
 /** Set all pin direction (I/O) settings in all banks.
  * @param banks All pins' new direction values (P00-P27) in 3-byte array
  */
 void TCA6424A::setAllDirection(uint8_t *banks) {
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, banks);
+    setAllDirection(banks[0], banks[1], banks[2]);
 }
 /** Set all pin direction (I/O) settings in all banks.
  * @param bank0 Bank 0's new direction values (P00-P07)
@@ -306,8 +523,9 @@ void TCA6424A::setAllDirection(uint8_t *banks) {
  * @param bank2 Bank 2's new direction values (P20-P27)
  */
 void TCA6424A::setAllDirection(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
-    buffer[0] = bank0;
-    buffer[1] = bank1;
-    buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    directionShadow[0] = bank0;
+    directionShadow[1] = bank1;
+    directionShadow[2] = bank2;
+    directionDirty = 0x07;
+    if (autoCommit) commit();
 }
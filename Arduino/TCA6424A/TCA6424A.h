@@ -88,6 +88,17 @@ THE SOFTWARE.
 #define TCA6424A_P26                22
 #define TCA6424A_P27                23
 
+#define TCA6424A_EDGE_FALLING       0
+#define TCA6424A_EDGE_RISING        1
+
+#define TCA6424A_EVENT_QUEUE_SIZE   32 // power of two, room for all 24 pins changing at once
+
+typedef struct {
+    uint32_t timestamp;     // micros() at the INT edge (or at the poll, without INT)
+    uint8_t pin;            // 0-23
+    uint8_t edge;           // TCA6424A_EDGE_RISING or TCA6424A_EDGE_FALLING
+} TCA6424AEvent;
+
 class TCA6424A {
     public:
         TCA6424A();
@@ -111,6 +122,19 @@ class TCA6424A {
         void writeBank(uint8_t bank, uint8_t value);
         void writeAll(uint8_t *banks);
         void writeAll(uint8_t bank0, uint8_t bank1, uint8_t bank2);
+        void writeAll(uint32_t mask, uint32_t values);
+
+        // OUTPUT/CONFIG shadow
+        void setAutoCommit(bool enabled);
+        bool getAutoCommit();
+        bool commit();
+
+        // input edge events
+        void interrupt();
+        bool pollInputs();
+        bool readEvent(TCA6424AEvent *event);
+        uint8_t getEventCount();
+        uint16_t getDroppedEvents();
 
         // POLARITY* registers (x8h - xAh)
         bool getPinPolarity(uint16_t pin);
@@ -135,6 +159,25 @@ class TCA6424A {
     private:
         uint8_t devAddr;
         uint8_t buffer[3];
+
+        uint8_t outputShadow[3];
+        uint8_t directionShadow[3];
+        uint8_t outputDirty;        // one bit per bank
+        uint8_t directionDirty;
+        bool autoCommit;
+
+        bool writeShadow(uint8_t regAddr, uint8_t *shadow, uint8_t *dirty);
+
+        uint8_t inputSnapshot[3];
+        bool inputSnapshotValid;    // false until the first input read
+        volatile bool interruptDriven;
+        volatile bool interruptPending;
+        volatile uint32_t interruptTime;
+
+        volatile TCA6424AEvent eventQueue[TCA6424A_EVENT_QUEUE_SIZE];
+        volatile uint8_t eventHead;     // written by pollInputs() only
+        volatile uint8_t eventTail;     // written by readEvent() only
+        uint16_t eventsDropped;
 };
 
 #endif /* _TCA6424A_H_ */